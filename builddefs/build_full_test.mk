@@ -16,11 +16,18 @@
 $(TEST)_INC := \
 	tests/test_common/common_config.h
 
+# With CUSTOM_MATRIX = lite the test only drives the pins of matrix_common.c
+ifeq ($(strip $(CUSTOM_MATRIX)), lite)
+    TEST_MATRIX_SRC := tests/test_common/matrix_lite.c
+else
+    TEST_MATRIX_SRC := tests/test_common/matrix.c
+endif
+
 $(TEST)_SRC := \
 	$(QUANTUM_SRC) \
 	$(SRC) \
 	$(QUANTUM_PATH)/keymap_introspection.c \
-	tests/test_common/matrix.c \
+	$(TEST_MATRIX_SRC) \
 	tests/test_common/test_driver.cpp \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/keycode_util.cpp \
@@ -379,28 +379,28 @@ endif
 
 	ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3742a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3742A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3743a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3743A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3745)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3745 -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(LED_MATRIX_DRIVER)), is31fl3746a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3746A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
@@ -481,28 +481,28 @@ endif
 
 	ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3742a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3742A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3743a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3743A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3745)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3745 -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
 
 	ifeq ($(strip $(RGB_MATRIX_DRIVER)), is31fl3746a)
         OPT_DEFS += -DIS31FLCOMMON -DIS31FL3746A -DSTM32_I2C -DHAL_USE_I2C=TRUE
-        COMMON_VPATH += $(DRIVER_PATH)/led/issi
+        COMMON_VPATH += $(DRIVER_PATH)/led $(DRIVER_PATH)/led/issi
         SRC += is31flcommon.c
         QUANTUM_LIB_SRC += i2c_master.c
     endif
@@ -537,6 +537,12 @@ ifeq ($(strip $(RGB_KEYCODES_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_rgb.c
 endif
 
+PERF_TRACE_ENABLE ?= no
+ifeq ($(strip $(PERF_TRACE_ENABLE)), yes)
+    SRC += $(QUANTUM_DIR)/perf_trace.c
+    OPT_DEFS += -DPERF_TRACE_ENABLE -DSTAGE_PROBE_ENABLE
+endif
+
 VARIABLE_TRACE ?= no
 ifneq ($(strip $(VARIABLE_TRACE)),no)
     SRC += $(QUANTUM_DIR)/variable_trace.c
@@ -657,6 +663,9 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
     endif
+else
+    # A custom matrix_scan() calls matrix_scan_kb() itself, so it stays on the main loop
+    OPT_DEFS += -DKEYEVENT_QUEUE_NO_THREAD
 endif
 
 # Debounce Modules. Set DEBOUNCE_TYPE=custom if including one manually.
@@ -688,6 +697,16 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
+        # The framebuffer is mirrored with RGB_MATRIX_SPLIT_FRAMEBUFFER or LED_MATRIX_SPLIT_FRAMEBUFFER, set in config.h
+        ifneq ($(filter yes,$(strip $(RGB_MATRIX_ENABLE) $(LED_MATRIX_ENABLE))),)
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_framebuffer.c
+        endif
+
+        ifeq ($(strip $(SPLIT_LINK_STATS_ENABLE)), yes)
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_link_stats.c
+            OPT_DEFS += -DSPLIT_LINK_STATS_ENABLE
+        endif
+
         # Functions added via QUANTUM_LIB_SRC are only included in the final binary if they're called.
         # Unused functions are pruned away, which is why we can add multiple drivers here without bloat.
         ifeq ($(PLATFORM),AVR)
@@ -17,6 +17,7 @@ SPACE_CADET_ENABLE ?= yes
 GRAVE_ESC_ENABLE ?= yes
 
 GENERIC_FEATURES = \
+    ACTION_CACHE \
     AUTOCORRECT \
     CAPS_WORD \
     COMBO \
@@ -28,6 +29,7 @@ GENERIC_FEATURES = \
     DYNAMIC_MACRO \
     GRAVE_ESC \
     HAPTIC \
+    KEYEVENT_QUEUE \
     KEY_LOCK \
     KEY_OVERRIDE \
     LEADER \
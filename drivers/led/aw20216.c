@@ -16,6 +16,7 @@
  */
 
 #include "aw20216.h"
+#include "led_dirty.h"
 #include "wait.h"
 #include "spi_master.h"
 
@@ -69,7 +70,9 @@
 #endif
 
 uint8_t g_pwm_buffer[DRIVER_COUNT][AW_PWM_REGISTER_COUNT];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+// The first update writes the whole page, the registers may hold anything after a restart
+bool    g_pwm_buffer_update_required[DRIVER_COUNT]                              = {[0 ... DRIVER_COUNT - 1] = true};
+uint8_t g_pwm_buffer_dirty[DRIVER_COUNT][LED_DIRTY_SIZE(AW_PWM_REGISTER_COUNT)] = {[0 ... DRIVER_COUNT - 1] = {[0 ... LED_DIRTY_SIZE(AW_PWM_REGISTER_COUNT) - 1] = 0xFF}};
 
 bool aw20216_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
     static uint8_t s_spi_transfer_buffer[2] = {0};
@@ -148,9 +151,12 @@ void aw20216_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
         return;
     }
-    g_pwm_buffer[led.driver][led.r]          = red;
-    g_pwm_buffer[led.driver][led.g]          = green;
-    g_pwm_buffer[led.driver][led.b]          = blue;
+    g_pwm_buffer[led.driver][led.r] = red;
+    g_pwm_buffer[led.driver][led.g] = green;
+    g_pwm_buffer[led.driver][led.b] = blue;
+    led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.r);
+    led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.g);
+    led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.b);
     g_pwm_buffer_update_required[led.driver] = true;
 }
 
@@ -162,7 +168,17 @@ void aw20216_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 
 void aw20216_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
-        aw20216_write(cs_pin, AW_PAGE_PWM, 0, g_pwm_buffer[index], AW_PWM_REGISTER_COUNT);
+        // Only write the ranges of registers that changed
+        uint16_t start = 0;
+        uint16_t size;
+        while ((size = led_dirty_next_range(g_pwm_buffer_dirty[index], AW_PWM_REGISTER_COUNT, &start)) > 0) {
+            if (!aw20216_write(cs_pin, AW_PAGE_PWM, start, &g_pwm_buffer[index][start], size)) {
+                // Try the whole page again with the next update
+                led_dirty_mark_all(g_pwm_buffer_dirty[index], AW_PWM_REGISTER_COUNT);
+                return;
+            }
+            start += size;
+        }
     }
     g_pwm_buffer_update_required[index] = false;
 }
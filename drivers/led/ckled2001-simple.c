@@ -16,7 +16,9 @@
 
 #include "ckled2001-simple.h"
 #include "i2c_master.h"
+#include "led_dirty.h"
 #include "wait.h"
+#include <string.h>
 
 #ifndef CKLED2001_TIMEOUT
 #    define CKLED2001_TIMEOUT 100
@@ -41,11 +43,12 @@ uint8_t g_twi_transfer_buffer[20];
 // These buffers match the CKLED2001 PWM registers.
 // The control buffers match the PG0 LED On/Off registers.
 // Storing them like this is optimal for I2C transfers to the registers.
-// We could optimize this and take out the unused registers from these
-// buffers and the transfers in ckled2001_write_pwm_buffer() but it's
-// probably not worth the extra complexity.
+// Only the ranges of PWM registers marked in g_pwm_buffer_dirty are
+// transferred, so unused registers are never sent after the first update.
 uint8_t g_pwm_buffer[DRIVER_COUNT][192];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+// The first update writes the whole page, the registers may hold anything after a restart
+bool    g_pwm_buffer_update_required[DRIVER_COUNT]            = {[0 ... DRIVER_COUNT - 1] = true};
+uint8_t g_pwm_buffer_dirty[DRIVER_COUNT][LED_DIRTY_SIZE(192)] = {[0 ... DRIVER_COUNT - 1] = {[0 ... LED_DIRTY_SIZE(192) - 1] = 0xFF}};
 
 uint8_t g_led_control_registers[DRIVER_COUNT][24]             = {0};
 bool    g_led_control_registers_update_required[DRIVER_COUNT] = {false};
@@ -69,37 +72,47 @@ bool ckled2001_write_register(uint8_t addr, uint8_t reg, uint8_t data) {
     return true;
 }
 
-bool ckled2001_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+static bool ckled2001_write_pwm_ranges(uint8_t addr, uint8_t *pwm_buffer, uint8_t dirty[LED_DIRTY_SIZE(192)]) {
     // Assumes PG1 is already selected.
     // If any of the transactions fails function returns false.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
+    // Transmit each changed range of PWM registers in transfers of up to 16 bytes.
     // g_twi_transfer_buffer[] is 20 bytes
-
-    // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (int i = 0; i < 192; i += 16) {
-        g_twi_transfer_buffer[0] = i;
-        // Copy the data from i to i+15.
-        // Device will auto-increment register for data after the first byte
-        // Thus this sets registers 0x00-0x0F, 0x10-0x1F, etc. in one transfer.
-        for (int j = 0; j < 16; j++) {
-            g_twi_transfer_buffer[1 + j] = pwm_buffer[i + j];
-        }
+    uint16_t start = 0;
+    uint16_t size;
+    while ((size = led_dirty_next_range(dirty, 192, &start)) > 0) {
+        for (uint16_t i = start; i < start + size; i += 16) {
+            uint8_t length           = start + size - i < 16 ? start + size - i : 16;
+            g_twi_transfer_buffer[0] = i;
+            // Copy the data from i to i+length-1.
+            // Device will auto-increment register for data after the first byte
+            // Thus this sets the whole run of registers in one transfer.
+            for (uint8_t j = 0; j < length; j++) {
+                g_twi_transfer_buffer[1 + j] = pwm_buffer[i + j];
+            }
 
 #if CKLED2001_PERSISTENCE > 0
-        for (uint8_t i = 0; i < CKLED2001_PERSISTENCE; i++) {
-            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, CKLED2001_TIMEOUT) != 0) {
-                return false;
+            for (uint8_t k = 0; k < CKLED2001_PERSISTENCE; k++) {
+                if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, CKLED2001_TIMEOUT) != 0) {
+                    return false;
+                }
             }
-        }
 #else
-        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, 17, CKLED2001_TIMEOUT) != 0) {
-            return false;
-        }
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, CKLED2001_TIMEOUT) != 0) {
+                return false;
+            }
 #endif
+        }
+        start += size;
     }
     return true;
 }
 
+bool ckled2001_write_pwm_buffer(uint8_t addr, uint8_t *pwm_buffer) {
+    uint8_t dirty[LED_DIRTY_SIZE(192)];
+    memset(dirty, 0xFF, sizeof(dirty));
+    return ckled2001_write_pwm_ranges(addr, pwm_buffer, dirty);
+}
+
 void ckled2001_init(uint8_t addr) {
     // Select to function page
     ckled2001_write_register(addr, CONFIGURE_CMD_PAGE, FUNCTION_PAGE);
@@ -154,7 +167,8 @@ void ckled2001_set_value(int index, uint8_t value) {
         if (g_pwm_buffer[led.driver][led.v] == value) {
             return;
         }
-        g_pwm_buffer[led.driver][led.v]          = value;
+        g_pwm_buffer[led.driver][led.v] = value;
+        led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.v);
         g_pwm_buffer_update_required[led.driver] = true;
     }
 }
@@ -186,14 +200,24 @@ void ckled2001_update_pwm_buffers(uint8_t addr, uint8_t index) {
         ckled2001_write_register(addr, CONFIGURE_CMD_PAGE, LED_PWM_PAGE);
 
         // If any of the transactions fail we risk writing dirty PG0,
-        // refresh page 0 just in case.
-        if (!ckled2001_write_pwm_buffer(addr, g_pwm_buffer[index])) {
+        // refresh page 0 just in case, and the whole PWM page next time.
+        if (!ckled2001_write_pwm_ranges(addr, g_pwm_buffer[index], g_pwm_buffer_dirty[index])) {
             g_led_control_registers_update_required[index] = true;
+            led_dirty_mark_all(g_pwm_buffer_dirty[index], 192);
+            return;
         }
     }
     g_pwm_buffer_update_required[index] = false;
 }
 
+// Rewrites the whole PWM page of every driver with the next update
+void ckled2001_invalidate_pwm_buffers(void) {
+    for (uint8_t index = 0; index < DRIVER_COUNT; index++) {
+        led_dirty_mark_all(g_pwm_buffer_dirty[index], 192);
+        g_pwm_buffer_update_required[index] = true;
+    }
+}
+
 void ckled2001_update_led_control_registers(uint8_t addr, uint8_t index) {
     if (g_led_control_registers_update_required[index]) {
         ckled2001_write_register(addr, CONFIGURE_CMD_PAGE, LED_CONTROL_PAGE);
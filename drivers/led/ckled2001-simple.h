@@ -41,6 +41,7 @@ void ckled2001_set_led_control_register(uint8_t index, bool value);
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void ckled2001_update_pwm_buffers(uint8_t addr, uint8_t index);
+void ckled2001_invalidate_pwm_buffers(void);
 void ckled2001_update_led_control_registers(uint8_t addr, uint8_t index);
 
 void ckled2001_sw_return_normal(uint8_t addr);
@@ -44,6 +44,7 @@ void is31fl3731_set_led_control_register(uint8_t index, bool value);
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void is31fl3731_update_pwm_buffers(uint8_t addr, uint8_t index);
+void is31fl3731_invalidate_pwm_buffers(void);
 void is31fl3731_update_led_control_registers(uint8_t addr, uint8_t index);
 
 #define C1_1 0x24
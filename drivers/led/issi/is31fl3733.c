@@ -250,6 +250,13 @@ void is31fl3733_update_pwm_buffers(uint8_t addr, uint8_t index) {
     g_pwm_buffer_update_required[index] = false;
 }
 
+// Rewrites the whole PWM page of every driver with the next update
+void is31fl3733_invalidate_pwm_buffers(void) {
+    for (uint8_t index = 0; index < DRIVER_COUNT; index++) {
+        g_pwm_buffer_update_required[index] = true;
+    }
+}
+
 void is31fl3733_update_led_control_registers(uint8_t addr, uint8_t index) {
     if (g_led_control_registers_update_required[index]) {
         // Firstly we need to unlock the command register and select PG0
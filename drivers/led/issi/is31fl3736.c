@@ -274,6 +274,13 @@ void is31fl3736_update_pwm_buffers(uint8_t addr, uint8_t index) {
     g_pwm_buffer_update_required[index] = false;
 }
 
+// Rewrites the whole PWM page of every driver with the next update
+void is31fl3736_invalidate_pwm_buffers(void) {
+    for (uint8_t index = 0; index < DRIVER_COUNT; index++) {
+        g_pwm_buffer_update_required[index] = true;
+    }
+}
+
 void is31fl3736_update_led_control_registers(uint8_t addr1, uint8_t addr2) {
     if (g_led_control_registers_update_required) {
         // Firstly we need to unlock the command register and select PG0
@@ -47,6 +47,7 @@ void is31fl3737_set_led_control_register(uint8_t index, bool red, bool green, bo
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void is31fl3737_update_pwm_buffers(uint8_t addr, uint8_t index);
+void is31fl3737_invalidate_pwm_buffers(void);
 void is31fl3737_update_led_control_registers(uint8_t addr, uint8_t index);
 
 #define PUR_0R 0x00   // No PUR resistor
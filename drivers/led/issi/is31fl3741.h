@@ -46,6 +46,7 @@ void is31fl3741_set_led_control_register(uint8_t index, bool red, bool green, bo
 // Call this while idle (in between matrix scans).
 // If the buffer is dirty, it will update the driver with the buffer.
 void is31fl3741_update_pwm_buffers(uint8_t addr, uint8_t index);
+void is31fl3741_invalidate_pwm_buffers(void);
 void is31fl3741_update_led_control_registers(uint8_t addr, uint8_t index);
 void is31fl3741_set_scaling_registers(const is31_led *pled, uint8_t red, uint8_t green, uint8_t blue);
 
@@ -20,6 +20,7 @@
 
 #include "is31flcommon.h"
 #include "i2c_master.h"
+#include "led_dirty.h"
 #include "wait.h"
 #include <string.h>
 
@@ -37,7 +38,9 @@ uint8_t g_twi_transfer_buffer[20];
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 uint8_t g_pwm_buffer[DRIVER_COUNT][ISSI_MAX_LEDS];
-bool    g_pwm_buffer_update_required[DRIVER_COUNT] = {false};
+// The first update writes the whole page, the registers may hold anything after a restart
+bool    g_pwm_buffer_update_required[DRIVER_COUNT]                      = {[0 ... DRIVER_COUNT - 1] = true};
+uint8_t g_pwm_buffer_dirty[DRIVER_COUNT][LED_DIRTY_SIZE(ISSI_MAX_LEDS)] = {[0 ... DRIVER_COUNT - 1] = {[0 ... LED_DIRTY_SIZE(ISSI_MAX_LEDS) - 1] = 0xFF}};
 
 uint8_t g_scaling_buffer[DRIVER_COUNT][ISSI_SCALING_SIZE];
 bool    g_scaling_buffer_update_required[DRIVER_COUNT] = {false};
@@ -83,6 +86,28 @@ bool IS31FL_write_multi_registers(uint8_t addr, uint8_t *source_buffer, uint8_t
     return true;
 }
 
+// Writes a range of registers in transfers of at most transfer_size, the last one may be shorter
+static bool IS31FL_write_register_range(uint8_t addr, uint8_t *source_buffer, uint16_t size, uint8_t transfer_size, uint8_t start_reg_addr) {
+    for (uint16_t i = 0; i < size; i += transfer_size) {
+        uint8_t length = size - i < transfer_size ? size - i : transfer_size;
+        g_twi_transfer_buffer[0] = start_reg_addr + i;
+        memcpy(g_twi_transfer_buffer + 1, source_buffer + i, length);
+
+#if ISSI_PERSISTENCE > 0
+        for (uint8_t j = 0; j < ISSI_PERSISTENCE; j++) {
+            if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, ISSI_TIMEOUT) != 0) {
+                return false;
+            }
+        }
+#else
+        if (i2c_transmit(addr << 1, g_twi_transfer_buffer, length + 1, ISSI_TIMEOUT) != 0) {
+            return false;
+        }
+#endif
+    }
+    return true;
+}
+
 void IS31FL_unlock_register(uint8_t addr, uint8_t page) {
     // unlock the command register and select Page to write
     IS31FL_write_single_register(addr, ISSI_COMMANDREGISTER_WRITELOCK, ISSI_REGISTER_UNLOCK);
@@ -124,13 +149,30 @@ void IS31FL_common_update_pwm_register(uint8_t addr, uint8_t index) {
     if (g_pwm_buffer_update_required[index]) {
         // Queue up the correct page
         IS31FL_unlock_register(addr, ISSI_PAGE_PWM);
-        // Hand off the update to IS31FL_write_multi_registers
-        IS31FL_write_multi_registers(addr, g_pwm_buffer[index], ISSI_MAX_LEDS, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST);
+        // Only write the ranges of registers that changed
+        uint16_t start = 0;
+        uint16_t size;
+        while ((size = led_dirty_next_range(g_pwm_buffer_dirty[index], ISSI_MAX_LEDS, &start)) > 0) {
+            if (!IS31FL_write_register_range(addr, &g_pwm_buffer[index][start], size, ISSI_PWM_TRF_SIZE, ISSI_PWM_REG_1ST + start)) {
+                // Try the whole page again with the next update
+                led_dirty_mark_all(g_pwm_buffer_dirty[index], ISSI_MAX_LEDS);
+                return;
+            }
+            start += size;
+        }
         // Update flags that pwm_buffer has been updated
         g_pwm_buffer_update_required[index] = false;
     }
 }
 
+// Rewrites the whole PWM page of every driver with the next update
+void IS31FL_common_invalidate_pwm_register(void) {
+    for (uint8_t index = 0; index < DRIVER_COUNT; index++) {
+        led_dirty_mark_all(g_pwm_buffer_dirty[index], ISSI_MAX_LEDS);
+        g_pwm_buffer_update_required[index] = true;
+    }
+}
+
 #ifdef ISSI_MANUAL_SCALING
 void IS31FL_set_manual_scaling_buffer(void) {
     is31_led led;
@@ -181,9 +223,15 @@ void IS31FL_RGB_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         is31_led led;
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
-        g_pwm_buffer[led.driver][led.r]          = red;
-        g_pwm_buffer[led.driver][led.g]          = green;
-        g_pwm_buffer[led.driver][led.b]          = blue;
+        if (g_pwm_buffer[led.driver][led.r] == red && g_pwm_buffer[led.driver][led.g] == green && g_pwm_buffer[led.driver][led.b] == blue) {
+            return;
+        }
+        g_pwm_buffer[led.driver][led.r] = red;
+        g_pwm_buffer[led.driver][led.g] = green;
+        g_pwm_buffer[led.driver][led.b] = blue;
+        led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.r);
+        led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.g);
+        led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.b);
         g_pwm_buffer_update_required[led.driver] = true;
     }
 }
@@ -234,7 +282,11 @@ void IS31FL_simple_set_brightness(int index, uint8_t value) {
         is31_led led;
         memcpy_P(&led, (&g_is31_leds[index]), sizeof(led));
 
+        if (g_pwm_buffer[led.driver][led.v] == value) {
+            return;
+        }
         g_pwm_buffer[led.driver][led.v] = value;
+        led_dirty_mark(g_pwm_buffer_dirty[led.driver], led.v);
         g_pwm_buffer_update_required[led.driver] = true;
     }
 }
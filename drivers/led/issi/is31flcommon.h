@@ -65,6 +65,7 @@ void IS31FL_unlock_register(uint8_t addr, uint8_t page);
 void IS31FL_common_init(uint8_t addr, uint8_t ssr);
 
 void IS31FL_common_update_pwm_register(uint8_t addr, uint8_t index);
+void IS31FL_common_invalidate_pwm_register(void);
 void IS31FL_common_update_scaling_register(uint8_t addr, uint8_t index);
 
 #ifdef RGB_MATRIX_ENABLE
@@ -0,0 +1,67 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Dirty tracking for the PWM registers of LED drivers.
+
+    Setting a color marks the registers it changes in a bitmap with one bit
+    per register. Flushing then walks the marked registers as contiguous
+    ranges, so a driver only rewrites what changed instead of its whole PWM
+    page. Ranges separated by no more than LED_DIRTY_MERGE_GAP unchanged
+    registers are sent as one, since rewriting a few unchanged registers
+    costs less bus time than starting another transfer.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef LED_DIRTY_MERGE_GAP
+#    define LED_DIRTY_MERGE_GAP 4
+#endif // LED_DIRTY_MERGE_GAP
+
+// Bytes of a bitmap for the given number of registers
+#define LED_DIRTY_SIZE(registers) (((registers) + 7) / 8)
+
+static inline void led_dirty_mark(uint8_t *dirty, uint16_t reg) {
+    dirty[reg / 8] |= 1 << (reg % 8);
+}
+
+static inline void led_dirty_mark_all(uint8_t *dirty, uint16_t registers) {
+    for (uint16_t reg = 0; reg < registers; reg++) {
+        led_dirty_mark(dirty, reg);
+    }
+}
+
+static inline bool led_dirty_test(const uint8_t *dirty, uint16_t reg) {
+    return dirty[reg / 8] & (1 << (reg % 8));
+}
+
+/**
+ * \brief Finds the next range of marked registers at or after *start.
+ *
+ * The registers of the range are unmarked, and *start is moved to its first
+ * register.
+ *
+ * \return The number of registers in the range, 0 once none are marked.
+ */
+static inline uint16_t led_dirty_next_range(uint8_t *dirty, uint16_t registers, uint16_t *start) {
+    uint16_t reg = *start;
+    while (reg < registers && !led_dirty_test(dirty, reg)) {
+        // Skip unmarked bytes whole
+        reg = dirty[reg / 8] ? reg + 1 : (reg / 8 + 1) * 8;
+    }
+    if (reg >= registers) {
+        return 0;
+    }
+
+    uint16_t end = reg; // one past the last marked register
+    *start       = reg;
+    for (; reg < registers && reg - end <= LED_DIRTY_MERGE_GAP; reg++) {
+        if (led_dirty_test(dirty, reg)) {
+            dirty[reg / 8] &= ~(1 << (reg % 8));
+            end = reg + 1;
+        }
+    }
+    return end - *start;
+}
@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "led_dirty.h"
+}
+
+// Not a multiple of 8, so the last byte of the bitmap is partly unused
+#define REGISTERS 45
+
+class LedDirty : public ::testing::Test {
+   protected:
+    uint8_t  dirty[LED_DIRTY_SIZE(REGISTERS)] = {};
+    uint16_t start                            = 0;
+
+    uint16_t next_range(void) {
+        return led_dirty_next_range(dirty, REGISTERS, &start);
+    }
+
+    bool all_clear(void) {
+        for (size_t i = 0; i < sizeof(dirty); i++) {
+            if (dirty[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(LedDirty, NothingMarkedHasNoRange) {
+    EXPECT_EQ(next_range(), 0);
+
+    start = 17;
+    EXPECT_EQ(next_range(), 0);
+}
+
+TEST_F(LedDirty, AllMarkedIsOneRange) {
+    led_dirty_mark_all(dirty, REGISTERS);
+
+    ASSERT_EQ(next_range(), REGISTERS);
+    EXPECT_EQ(start, 0);
+    EXPECT_TRUE(all_clear());
+
+    start += REGISTERS;
+    EXPECT_EQ(next_range(), 0);
+}
+
+TEST_F(LedDirty, SingleRegister) {
+    led_dirty_mark(dirty, 20);
+
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, 20);
+    EXPECT_TRUE(all_clear());
+}
+
+TEST_F(LedDirty, UnmarkedBytesAreSkipped) {
+    led_dirty_mark(dirty, 3);
+    led_dirty_mark(dirty, 33);
+
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, 3);
+    start += 1;
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, 33);
+    EXPECT_TRUE(all_clear());
+}
+
+TEST_F(LedDirty, RangesWithinTheGapAreMerged) {
+    led_dirty_mark(dirty, 6);
+    led_dirty_mark(dirty, 6 + LED_DIRTY_MERGE_GAP + 1);
+
+    // The unchanged registers between them are rewritten too
+    ASSERT_EQ(next_range(), LED_DIRTY_MERGE_GAP + 2);
+    EXPECT_EQ(start, 6);
+    EXPECT_TRUE(all_clear());
+}
+
+TEST_F(LedDirty, RangesBeyondTheGapAreSeparate) {
+    led_dirty_mark(dirty, 6);
+    led_dirty_mark(dirty, 7);
+    led_dirty_mark(dirty, 7 + LED_DIRTY_MERGE_GAP + 2);
+
+    ASSERT_EQ(next_range(), 2);
+    EXPECT_EQ(start, 6);
+    // The later range stays marked for the next call
+    EXPECT_TRUE(led_dirty_test(dirty, 7 + LED_DIRTY_MERGE_GAP + 2));
+
+    start += 2;
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, 7 + LED_DIRTY_MERGE_GAP + 2);
+    EXPECT_TRUE(all_clear());
+}
+
+TEST_F(LedDirty, LastRegister) {
+    led_dirty_mark(dirty, REGISTERS - 3);
+    led_dirty_mark(dirty, REGISTERS - 1);
+
+    ASSERT_EQ(next_range(), 3);
+    EXPECT_EQ(start, REGISTERS - 3);
+    EXPECT_TRUE(all_clear());
+
+    led_dirty_mark(dirty, REGISTERS - 1);
+    start = 0;
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, REGISTERS - 1);
+}
+
+TEST_F(LedDirty, BitsPastTheLastRegisterAreIgnored) {
+    // Unused bits of the last byte
+    dirty[sizeof(dirty) - 1] = 0xFF << (REGISTERS % 8);
+
+    EXPECT_EQ(next_range(), 0);
+
+    led_dirty_mark(dirty, REGISTERS - 1);
+    ASSERT_EQ(next_range(), 1);
+    EXPECT_EQ(start, REGISTERS - 1);
+}
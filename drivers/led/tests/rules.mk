@@ -0,0 +1,4 @@
+led_dirty_INC := $(DRIVER_PATH)/led
+
+led_dirty_SRC := \
+	$(DRIVER_PATH)/led/tests/led_dirty_tests.cpp
@@ -28,6 +28,31 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SPLIT_MATRIX_PUSH
+// target sends a frame without waiting for a transaction, full-duplex only
+bool soft_serial_target_push(const uint8_t *payload, uint8_t size);
+// initiator hands the frames pushed so far to transaction_push_received()
+void soft_serial_initiator_receive_pushes(void);
+#endif
+
+#ifdef SERIAL_USART_SPEED_NEGOTIATION
+// step n runs at SERIAL_USART_SPEED << n, negotiation tries steps up to this one
+#    ifndef SERIAL_USART_SPEED_MAX_STEP
+#        define SERIAL_USART_SPEED_MAX_STEP 2
+#    endif
+// milliseconds without any transaction after which the target falls back to step 0
+#    ifndef SERIAL_USART_SPEED_FALLBACK_TIMEOUT
+#        define SERIAL_USART_SPEED_FALLBACK_TIMEOUT 500
+#    endif
+
+// current speed step, the link runs at SERIAL_USART_SPEED << step
+uint8_t soft_serial_get_speed_step(void);
+// initiator switches right away, before its next transaction
+void soft_serial_initiator_set_speed_step(uint8_t step);
+// target switches once the reply to the current transaction has been sent
+void soft_serial_target_request_speed_step(uint8_t step);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
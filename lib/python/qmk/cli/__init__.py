@@ -78,6 +78,7 @@ subcommands = [
     'qmk.cli.new.keyboard',
     'qmk.cli.new.keymap',
     'qmk.cli.painter',
+    'qmk.cli.perf_trace',
     'qmk.cli.pytest',
     'qmk.cli.via2json',
 ]
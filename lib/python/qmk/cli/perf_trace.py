@@ -0,0 +1,33 @@
+"""Render a hot-path trace captured from the firmware console.
+"""
+import sys
+
+from argcomplete.completers import FilesCompleter
+from milc import cli
+
+import qmk.path
+from qmk.perf_trace import decode_console, render_timeline
+
+
+@cli.argument('-t', '--ticks-per-us', arg_only=True, type=float, default=1.0, help='Trace timestamp ticks per microsecond, e.g. the MCU clock in MHz for ChibiOS. Default: 1')
+@cli.argument('filename', arg_only=True, nargs='?', default='-', completer=FilesCompleter('.txt'), help='Captured console output, or - for stdin')
+@cli.subcommand('Renders a timeline from PERF_TRACE_ENABLE console output.', hidden=False if cli.config.user.developer else True)
+def perf_trace(cli):
+    """Decodes the `perf_trace:` lines emitted by quantum/perf_trace.c and prints a timeline with per-stage totals.
+    """
+    if cli.args.filename == '-':
+        lines = sys.stdin.readlines()
+    else:
+        filename = qmk.path.normpath(cli.args.filename)
+        if not filename.exists():
+            cli.log.error('File %s does not exist!', filename)
+            return False
+        lines = filename.read_text(encoding='utf-8', errors='replace').splitlines()
+
+    batches = list(decode_console(lines))
+    if not batches:
+        cli.log.error('No perf_trace records found.')
+        return False
+
+    for line in render_timeline(batches, cli.args.ticks_per_us):
+        print(line)
@@ -0,0 +1,138 @@
+"""Decoder for the firmware's hot-path trace buffer (quantum/perf_trace.c).
+"""
+import struct
+from collections import namedtuple
+
+# Must match stage_probe_t in quantum/stage_probe.h
+STAGES = [
+    'matrix_scan',
+    'action_exec',
+    'process_record',
+    'host_send',
+    'usb_send_report',
+    'split_transaction',
+    'split_slave',
+]
+
+EVENT_USER = 0x80
+CONSOLE_PREFIX = 'perf_trace:'
+
+# Must match perf_trace_record_t: timestamp, arg, event, sequence
+RECORD = struct.Struct('<IHBB')
+
+TraceRecord = namedtuple('TraceRecord', ['timestamp', 'arg', 'event', 'sequence'])
+
+
+def event_name(event):
+    """Returns a printable name for an event id.
+    """
+    if event >= EVENT_USER:
+        return f'user_{event - EVENT_USER}'
+
+    stage = event >> 1
+    if stage < len(STAGES):
+        return STAGES[stage]
+
+    return f'unknown_{event:02X}'
+
+
+def decode_records(data):
+    """Unpacks a byte string of packed records.
+    """
+    for offset in range(0, len(data) - len(data) % RECORD.size, RECORD.size):
+        yield TraceRecord(*RECORD.unpack_from(data, offset))
+
+
+def decode_raw_hid_report(report):
+    """Decodes a raw HID response to PERF_TRACE_RAW_HID_COMMAND into (dropped, records).
+    """
+    count = report[1]
+    dropped = report[2]
+    return dropped, list(decode_records(bytes(report[3:3 + count * RECORD.size])))
+
+
+def decode_console(lines):
+    """Extracts (dropped, records) batches from captured console output.
+
+    Other console output is skipped, so a raw `qmk console` capture can be passed in.
+    """
+    for line in lines:
+        index = line.find(CONSOLE_PREFIX)
+        if index < 0:
+            continue
+
+        try:
+            dropped, payload = line[index + len(CONSOLE_PREFIX):].strip().split(':', 1)
+            yield int(dropped, 16), list(decode_records(bytes.fromhex(payload)))
+        except ValueError:
+            continue
+
+
+def _elapsed(start, end):
+    return (end - start) & 0xFFFFFFFF
+
+
+def render_timeline(batches, ticks_per_us=1.0):
+    """Renders decoded batches as an indented timeline followed by a per-stage summary.
+
+    Returns a list of lines.
+    """
+    lines = [f'{"time(us)":>12} {"dur(us)":>10}  event']
+    stats = {}
+    stack = []
+    origin = None
+    last_sequence = None
+
+    def us(ticks):
+        return ticks / ticks_per_us
+
+    for dropped, records in batches:
+        if dropped:
+            lines.append(f'{"":>12} {"":>10}  -- {dropped} records dropped --')
+            stack.clear()
+            last_sequence = None
+
+        for record in records:
+            if last_sequence is not None and record.sequence != (last_sequence + 1) & 0xFF:
+                lines.append(f'{"":>12} {"":>10}  -- sequence gap --')
+                stack.clear()
+            last_sequence = record.sequence
+
+            if origin is None:
+                origin = record.timestamp
+            timestamp = us(_elapsed(origin, record.timestamp))
+            name = event_name(record.event)
+
+            if record.event >= EVENT_USER:
+                lines.append(f'{timestamp:12.3f} {"":>10}  {"  " * len(stack)}* {name} arg={record.arg}')
+
+            elif record.event & 1 == 0:
+                lines.append(f'{timestamp:12.3f} {"":>10}  {"  " * len(stack)}> {name} arg={record.arg}')
+                stack.append((record.event >> 1, record.timestamp))
+
+            else:
+                duration = None
+                # Unwind to the matching begin, anything above it lost its end record.
+                while stack:
+                    stage, started = stack.pop()
+                    if stage == record.event >> 1:
+                        duration = us(_elapsed(started, record.timestamp))
+                        break
+
+                indent = '  ' * len(stack)
+                if duration is None:
+                    lines.append(f'{timestamp:12.3f} {"?":>10}  {indent}< {name} arg={record.arg}')
+                    continue
+
+                lines.append(f'{timestamp:12.3f} {duration:10.3f}  {indent}< {name} arg={record.arg}')
+                count, total, maximum = stats.get(name, (0, 0.0, 0.0))
+                stats[name] = (count + 1, total + duration, max(maximum, duration))
+
+    lines.append('')
+    lines.append(f'{"stage":<20} {"count":>8} {"total(us)":>12} {"mean(us)":>10} {"max(us)":>10}')
+    for name in STAGES:
+        if name in stats:
+            count, total, maximum = stats[name]
+            lines.append(f'{name:<20} {count:>8} {total:12.3f} {total / count:10.3f} {maximum:10.3f}')
+
+    return lines
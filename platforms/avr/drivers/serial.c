@@ -425,7 +425,18 @@ ISR(SERIAL_PIN_INTERRUPT) {
 
     // target recive phase
     if (trans->initiator2target_buffer_size > 0) {
-        serial_recive_packet((uint8_t *)split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        uint8_t *buffer = (uint8_t *)split_trans_initiator2target_buffer(trans);
+        uint8_t  size   = trans->initiator2target_buffer_size;
+        // length-prefixed buffers only carry as many bytes as their first byte announces
+        if (split_transaction_is_length_prefixed(tid)) {
+            serial_recive_packet(buffer, 1);
+            if (buffer[0] >= size) {
+                buffer[0] = 0;
+            }
+            size = buffer[0];
+            buffer++;
+        }
+        serial_recive_packet(buffer, size);
     }
 
     sync_recv(); // weit initiator output to high
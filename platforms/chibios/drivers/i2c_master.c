@@ -124,8 +124,8 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
 
     // From ChibiOS HAL: "After a timeout the driver must be stopped and
     // restarted because the bus is in an uncertain state." We also issue that
-    // hard stop in case of any error.
-    i2c_stop();
+    // hard stop in case of any error. The bus lock is already held here.
+    i2cStop(&I2C_DRIVER);
 
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
@@ -150,29 +150,197 @@ __attribute__((weak)) void i2c_init(void) {
     }
 }
 
+#ifdef I2C_QUEUE_ENABLE
+/*
+    Writes issued between i2c_queue_begin() and i2c_queue_end() are copied
+    into the queue instead of being sent, and a thread sends them afterwards
+    while the main loop carries on. The thread sleeps on each transfer, which
+    the I2C driver completes by DMA or interrupts. Every transfer holds the
+    bus mutex, so other I2C users may interleave with a batch in flight.
+    Writes that fail are only recorded, see i2c_queue_failed().
+*/
+
+#    ifndef I2C_QUEUE_SIZE
+#        define I2C_QUEUE_SIZE 1024
+#    endif
+
+#    ifndef I2C_QUEUE_STACK_SIZE
+#        define I2C_QUEUE_STACK_SIZE 256
+#    endif
+
+#    ifndef I2C_QUEUE_PRIORITY
+#        define I2C_QUEUE_PRIORITY (NORMALPRIO + 1)
+#    endif
+
+// Address, length and timeout of each queued write, followed by its data
+#    define I2C_QUEUE_ENTRY_HEADER 5
+
+static MUTEX_DECL(i2c_bus_mutex);
+#    define i2c_bus_lock() chMtxLock(&i2c_bus_mutex)
+#    define i2c_bus_unlock() chMtxUnlock(&i2c_bus_mutex)
+
+// Only touched by the queue thread while a batch is busy
+static uint8_t  i2c_queue_buffer[I2C_QUEUE_SIZE];
+static uint16_t i2c_queue_length    = 0;
+static bool     i2c_queue_deferring = false;
+static bool     i2c_queue_sending   = false;
+static bool     i2c_queue_error     = false;
+static BSEMAPHORE_DECL(i2c_queue_start, true);
+// Taken while a batch is in flight
+static BSEMAPHORE_DECL(i2c_queue_done, false);
+
+static void i2c_queue_flush_pending(void);
+#else
+#    define i2c_bus_lock()
+#    define i2c_bus_unlock()
+#    define i2c_queue_flush_pending()
+#endif // I2C_QUEUE_ENABLE
+
 i2c_status_t i2c_start(uint8_t address) {
+    i2c_queue_flush_pending();
+    i2c_bus_lock();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
+    i2c_bus_unlock();
     return I2C_STATUS_SUCCESS;
 }
 
-i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+static i2c_status_t i2c_transmit_locked(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_bus_lock();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    i2c_bus_unlock();
+    return result;
+}
+
+#ifdef I2C_QUEUE_ENABLE
+static void i2c_queue_drain(void) {
+    uint16_t offset = 0;
+    while (offset < i2c_queue_length) {
+        uint8_t* entry   = &i2c_queue_buffer[offset];
+        uint16_t length  = entry[1] | (entry[2] << 8);
+        uint16_t timeout = entry[3] | (entry[4] << 8);
+        // A failed write does not hold up the rest of the batch
+        if (i2c_transmit_locked(entry[0], &entry[I2C_QUEUE_ENTRY_HEADER], length, timeout) != I2C_STATUS_SUCCESS) {
+            __atomic_store_n(&i2c_queue_error, true, __ATOMIC_RELEASE);
+        }
+        offset += I2C_QUEUE_ENTRY_HEADER + length;
+    }
+    i2c_queue_length = 0;
+}
+
+// Sends what has been queued so far, for anything that has to follow it on the bus
+static void i2c_queue_flush_pending(void) {
+    if (i2c_queue_deferring) {
+        i2c_queue_drain();
+    }
+}
+
+static bool i2c_queue_push(uint8_t address, const uint8_t* header, uint8_t header_length, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    uint16_t size = I2C_QUEUE_ENTRY_HEADER + header_length + length;
+    if (!i2c_queue_deferring) {
+        return false;
+    }
+    if (i2c_queue_length + size > sizeof(i2c_queue_buffer)) {
+        // Out of room, send the batch so far right away
+        i2c_queue_drain();
+    }
+    if (size > sizeof(i2c_queue_buffer)) {
+        // Never fits, the caller sends it directly
+        return false;
+    }
+
+    uint8_t* entry = &i2c_queue_buffer[i2c_queue_length];
+    entry[0]       = address;
+    entry[1]       = (header_length + length) & 0xFF;
+    entry[2]       = (header_length + length) >> 8;
+    entry[3]       = timeout & 0xFF;
+    entry[4]       = timeout >> 8;
+    memcpy(&entry[I2C_QUEUE_ENTRY_HEADER], header, header_length);
+    memcpy(&entry[I2C_QUEUE_ENTRY_HEADER + header_length], data, length);
+    i2c_queue_length += size;
+    return true;
+}
+
+static THD_WORKING_AREA(waI2CQueueThread, I2C_QUEUE_STACK_SIZE);
+static THD_FUNCTION(I2CQueueThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_queue");
+
+    while (true) {
+        chBSemWait(&i2c_queue_start);
+        i2c_queue_drain();
+        // Publish the empty queue before the main loop may look at it
+        __atomic_store_n(&i2c_queue_sending, false, __ATOMIC_RELEASE);
+        chBSemSignal(&i2c_queue_done);
+    }
+}
+
+void i2c_queue_begin(void) {
+    i2c_queue_wait();
+    i2c_queue_deferring = true;
+}
+
+void i2c_queue_end(void) {
+    static thread_t* thread = NULL;
+
+    i2c_queue_deferring = false;
+    if (i2c_queue_length == 0) {
+        return;
+    }
+    if (!thread) {
+        thread = chThdCreateStatic(waI2CQueueThread, sizeof(waI2CQueueThread), I2C_QUEUE_PRIORITY, I2CQueueThread, NULL);
+    }
+
+    // Free since i2c_queue_begin() waited for the previous batch
+    chBSemWait(&i2c_queue_done);
+    __atomic_store_n(&i2c_queue_sending, true, __ATOMIC_RELEASE);
+    chBSemSignal(&i2c_queue_start);
+}
+
+bool i2c_queue_busy(void) {
+    return __atomic_load_n(&i2c_queue_sending, __ATOMIC_ACQUIRE);
+}
+
+void i2c_queue_wait(void) {
+    // Sleeps until the thread is done, then hands the semaphore back
+    chBSemWait(&i2c_queue_done);
+    chBSemSignal(&i2c_queue_done);
+}
+
+bool i2c_queue_failed(void) {
+    return __atomic_exchange_n(&i2c_queue_error, false, __ATOMIC_ACQ_REL);
+}
+#else
+static inline bool i2c_queue_push(uint8_t address, const uint8_t* header, uint8_t header_length, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    return false;
+}
+#endif // I2C_QUEUE_ENABLE
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    if (i2c_queue_push(address, data, 0, data, length, timeout)) {
+        return I2C_STATUS_SUCCESS;
+    }
+    return i2c_transmit_locked(address, data, length, timeout);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_queue_flush_pending();
+    i2c_bus_lock();
     i2c_address = address;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    msg_t        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (i2c_address >> 1), data, length, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    i2c_bus_unlock();
+    return result;
 }
 
 i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    if (i2c_queue_push(devaddr, &regaddr, 1, data, length, timeout)) {
+        return I2C_STATUS_SUCCESS;
+    }
 
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
@@ -180,13 +348,14 @@ i2c_status_t i2c_writeReg(uint8_t devaddr, uint8_t regaddr, const uint8_t* data,
     }
     complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transmit_locked(devaddr, complete_packet, length + 1, timeout);
 }
 
 i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2c_address = devaddr;
-    i2cStart(&I2C_DRIVER, &i2cconfig);
+    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
+    if (i2c_queue_push(devaddr, register_packet, 2, data, length, timeout)) {
+        return I2C_STATUS_SUCCESS;
+    }
 
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
@@ -195,25 +364,35 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    return i2c_transmit_locked(devaddr, complete_packet, length + 2, timeout);
 }
 
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_queue_flush_pending();
+    i2c_bus_lock();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    msg_t        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
+    i2c_status_t result = i2c_epilogue(status);
+    i2c_bus_unlock();
+    return result;
 }
 
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_queue_flush_pending();
+    i2c_bus_lock();
     i2c_address = devaddr;
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
-    msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    uint8_t      register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
+    msg_t        status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2c_address >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
+    i2c_status_t result             = i2c_epilogue(status);
+    i2c_bus_unlock();
+    return result;
 }
 
 void i2c_stop(void) {
+    i2c_queue_flush_pending();
+    i2c_bus_lock();
     i2cStop(&I2C_DRIVER);
+    i2c_bus_unlock();
 }
@@ -25,6 +25,12 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
+
+// The asynchronous LED matrix flush sends its writes through the queue
+#if defined(RGB_MATRIX_ASYNC_FLUSH) || defined(LED_MATRIX_ASYNC_FLUSH)
+#    define I2C_QUEUE_ENABLE
+#endif
 
 typedef int16_t i2c_status_t;
 
@@ -41,3 +47,12 @@ i2c_status_t i2c_writeReg16(uint8_t devaddr, uint16_t regaddr, const uint8_t* da
 i2c_status_t i2c_readReg(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_readReg16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 void         i2c_stop(void);
+
+#ifdef I2C_QUEUE_ENABLE
+void i2c_queue_begin(void);
+void i2c_queue_end(void);
+bool i2c_queue_busy(void);
+void i2c_queue_wait(void);
+// Whether a queued write has failed since the last call
+bool i2c_queue_failed(void);
+#endif // I2C_QUEUE_ENABLE
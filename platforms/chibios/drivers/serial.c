@@ -167,11 +167,20 @@ void interrupt_handler(void *arg) {
     sstd_index = serial_read_byte();
     sync_send();
 
-    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
-    for (int i = 0; i < trans->initiator2target_buffer_size; ++i) {
-        split_trans_initiator2target_buffer(trans)[i] = serial_read_byte();
+    split_transaction_desc_t *trans  = &split_transaction_table[sstd_index];
+    uint8_t                  *buffer = split_trans_initiator2target_buffer(trans);
+    int                       size   = trans->initiator2target_buffer_size;
+    for (int i = 0; i < size; ++i) {
+        buffer[i] = serial_read_byte();
         sync_send();
-        checksum_computed += split_trans_initiator2target_buffer(trans)[i];
+        checksum_computed += buffer[i];
+        // length-prefixed buffers only carry as many bytes as their first byte announces
+        if (i == 0 && split_transaction_is_length_prefixed(sstd_index)) {
+            if (buffer[0] >= size) {
+                buffer[0] = 0;
+            }
+            size = buffer[0] + 1;
+        }
     }
     checksum_computed ^= 7;
 
@@ -6,9 +6,91 @@
 #include "serial.h"
 #include "serial_protocol.h"
 #include "synchronization_util.h"
+#include "split_link_stats.h"
 
 static inline bool initiate_transaction(uint8_t transaction_id);
-static inline bool react_to_transaction(void);
+static inline bool react_to_transaction(bool* idle);
+#if defined(SPLIT_MATRIX_PUSH)
+static inline void receive_pushed_frame(void);
+#endif
+
+/* Serializes the use of the link on the initiator. Transaction buffers are only
+ * touched by the thread running the transaction, so unlike on the target the
+ * shared memory stays unlocked while bytes are on the wire. */
+static MUTEX_DECL(serial_link_mutex);
+
+static inline unsigned serial_link_lock(void) {
+    chMtxLock(&serial_link_mutex);
+    return 0;
+}
+
+static inline void serial_link_unlock(unsigned* unused_guard) {
+    chMtxUnlock(&serial_link_mutex);
+}
+
+/* Holds the link until the enclosing block ends, like split_shared_memory_lock_autounlock(). */
+#define serial_link_lock_autounlock() unsigned serial_link_guard __attribute__((unused, cleanup(serial_link_unlock))) = serial_link_lock()
+
+#if defined(SERIAL_TRANSPORT_CHECKED)
+/* Transaction buffers carry a checksum of the driver, handshakes and length prefixes do not. */
+#    define send_buffer serial_transport_send_checked
+#    define receive_buffer serial_transport_receive_checked
+#else
+#    define send_buffer serial_transport_send
+#    define receive_buffer serial_transport_receive
+#endif
+
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+/* Time the slave gets to follow a switch, before the master talks to it at the new speed. */
+#    define SPEED_SWITCH_SETTLE_TIME TIME_MS2I(1)
+
+static uint8_t   speed_step           = 0;
+static uint8_t   requested_speed_step = 0;
+static systime_t last_transaction     = 0;
+static bool      speed_switching      = false;
+static systime_t speed_switched_at    = 0;
+
+/**
+ * @brief Switch the driver to another speed step, with the link held on the initiator or the shared memory lock on the target.
+ */
+static void apply_speed_step(uint8_t step) {
+    if (step == speed_step) {
+        return;
+    }
+    speed_step = step;
+    serial_transport_set_speed_step(step);
+    SPLIT_LINK_STATS_RECORD_SPEED_STEP(step);
+}
+
+uint8_t soft_serial_get_speed_step(void) {
+    return speed_step;
+}
+
+void soft_serial_initiator_set_speed_step(uint8_t step) {
+    serial_link_lock_autounlock();
+    apply_speed_step(step);
+    /* The next transaction waits for the slave to switch as well, nothing sleeps with the link held until then. */
+    speed_switching   = true;
+    speed_switched_at = chVTGetSystemTimeX();
+}
+
+/**
+ * @brief Let the slave finish a switch before the next transaction, with the link held.
+ */
+static inline void wait_for_speed_switch(void) {
+    if (unlikely(speed_switching)) {
+        sysinterval_t elapsed = chVTTimeElapsedSinceX(speed_switched_at);
+        if (elapsed < SPEED_SWITCH_SETTLE_TIME) {
+            chThdSleep(SPEED_SWITCH_SETTLE_TIME - elapsed);
+        }
+        speed_switching = false;
+    }
+}
+
+void soft_serial_target_request_speed_step(uint8_t step) {
+    requested_speed_step = step;
+}
+#endif
 
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
@@ -20,10 +102,25 @@ static THD_FUNCTION(SlaveThread, arg) {
     chRegSetThreadName("split_protocol_tx_rx");
 
     while (true) {
-        if (unlikely(!react_to_transaction())) {
+        bool idle = false;
+        if (unlikely(!react_to_transaction(&idle))) {
             /* Clear the receive queue, to start with a clean slate.
              * Parts of failed transactions or spurious bytes could still be in it. */
             serial_transport_driver_clear();
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+            /* The master falls back to the base speed on a failed transaction, follow it there right away.
+             * A link that only went quiet falls back once the keep-alives stop as well. */
+            if (speed_step != 0 && (!idle || chVTTimeElapsedSinceX(last_transaction) > TIME_MS2I(SERIAL_USART_SPEED_FALLBACK_TIMEOUT))) {
+                split_shared_memory_lock_autounlock();
+                requested_speed_step = 0;
+                apply_speed_step(0);
+            }
+        } else {
+            /* A speed change requested by the transaction only applies once its reply is out. */
+            split_shared_memory_lock_autounlock();
+            last_transaction = chVTGetSystemTimeX();
+            apply_speed_step(requested_speed_step);
+#endif
         }
     }
 }
@@ -45,13 +142,28 @@ void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
 }
 
+/**
+ * @brief Wait until there is a transaction for us.
+ */
+static inline bool receive_transaction_id(uint8_t* transaction_id) {
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+    /* Above the base speed, stop waiting now and then to notice a lost link. */
+    if (speed_step != 0) {
+        return serial_transport_receive(transaction_id, sizeof(*transaction_id));
+    }
+#endif
+    return serial_transport_receive_blocking(transaction_id, sizeof(*transaction_id));
+}
+
 /**
  * @brief React to transactions started by the master.
+ *
+ * @param idle Set if no transaction started at all.
  */
-static inline bool react_to_transaction(void) {
+static inline bool react_to_transaction(bool* idle) {
     uint8_t transaction_id = 0;
-    /* Wait until there is a transaction for us. */
-    if (unlikely(!serial_transport_receive_blocking(&transaction_id, sizeof(transaction_id)))) {
+    if (unlikely(!receive_transaction_id(&transaction_id))) {
+        *idle = true;
         return false;
     }
 
@@ -62,7 +174,8 @@ static inline bool react_to_transaction(void) {
 
     split_shared_memory_lock_autounlock();
 
-    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+    split_transaction_desc_t* transaction     = &split_transaction_table[transaction_id];
+    bool                      length_prefixed = split_transaction_is_length_prefixed(transaction_id);
 
     /* Send back the handshake which is XORed as a simple checksum,
      to signal that the slave is ready to receive possible transaction buffers  */
@@ -73,7 +186,29 @@ static inline bool react_to_transaction(void) {
 
     /* Receive transaction buffer from the master. If this transaction requires it.*/
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        uint8_t* buffer = split_trans_initiator2target_buffer(transaction);
+        size_t   size   = transaction->initiator2target_buffer_size;
+
+        /* Length-prefixed buffers only carry as many bytes as their first byte announces. */
+        if (length_prefixed) {
+            if (unlikely(!serial_transport_receive(buffer, 1))) {
+                return false;
+            }
+            if (unlikely(buffer[0] >= size)) {
+                buffer[0] = 0;
+                return false;
+            }
+            size = buffer[0];
+            buffer++;
+        }
+
+#if defined(SERIAL_TRANSPORT_CHECKED)
+        /* Even an empty payload is followed by its checksum. */
+        bool receive = true;
+#else
+        bool receive = size != 0;
+#endif
+        if (unlikely(receive && !receive_buffer(buffer, size))) {
             return false;
         }
     }
@@ -85,7 +220,7 @@ static inline bool react_to_transaction(void) {
 
     /* Send transaction buffer to the master. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!send_buffer(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             return false;
         }
     }
@@ -100,11 +235,33 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#if defined(SPLIT_MATRIX_PUSH)
+    /* Frames pushed by the slave since the last transaction wait in the receive queue. */
+    soft_serial_initiator_receive_pushes();
+#endif
+
+    /* Another thread may be in the middle of a transaction, so only touch
+     * the receive queue while holding the link. */
+    serial_link_lock_autounlock();
+
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
 
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+    wait_for_speed_switch();
+    bool okay = initiate_transaction((uint8_t)index);
+
+    /* Any error above the base speed falls back to it, the slave does the same on its side of the failed frame. */
+    if (unlikely(!okay && speed_step != 0)) {
+        serial_dprintf("SPLIT: falling back to base speed\n");
+        apply_speed_step(0);
+    }
+
+    return okay;
+#else
     return initiate_transaction((uint8_t)index);
+#endif
 }
 
 /**
@@ -117,8 +274,6 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
         return false;
     }
 
-    split_shared_memory_lock_autounlock();
-
     split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
 
     /* Send transaction table index to the slave, which doubles as basic handshake token. */
@@ -133,14 +288,45 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)))) {
+        serial_dprintf("SPLIT: receiving handshake failed\n");
+        return false;
+    }
+
+#if defined(SPLIT_MATRIX_PUSH)
+    /* The slave may have pushed a frame right before it noticed our handshake. */
+    while (transaction_id_shake == SPLIT_PUSH_MARKER) {
+        receive_pushed_frame();
+        if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)))) {
+            serial_dprintf("SPLIT: receiving handshake failed\n");
+            return false;
+        }
+    }
+#endif
+
+    if (unlikely(transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
 
     /* Send transaction buffer to the slave. If this transaction requires it. */
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        const uint8_t* buffer = split_trans_initiator2target_buffer(transaction);
+        size_t         size   = transaction->initiator2target_buffer_size;
+
+#if defined(SERIAL_TRANSPORT_CHECKED)
+        /* The slave reads the length prefix on its own, before the checked payload. */
+        if (split_transaction_is_length_prefixed(transaction_id)) {
+            if (unlikely(!serial_transport_send(buffer, 1))) {
+                serial_dprintf("SPLIT: sending buffer failed\n");
+                return false;
+            }
+            buffer++;
+            size--;
+        }
+#endif
+
+        if (unlikely(!send_buffer(buffer, size))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
@@ -148,7 +334,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!receive_buffer(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             serial_dprintf("SPLIT: receiving buffer failed\n");
             return false;
         }
@@ -156,3 +342,58 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#if defined(SPLIT_MATRIX_PUSH)
+
+/**
+ * @brief Push a frame to the master without waiting for a transaction. Only
+ * possible in full-duplex, where the slave owns its tx line.
+ *
+ * @return bool Indicates success of sending the frame.
+ */
+bool soft_serial_target_push(const uint8_t* payload, uint8_t size) {
+    /* Never interleave with a response of the slave thread. */
+    split_shared_memory_lock_autounlock();
+
+    uint8_t header[2] = {SPLIT_PUSH_MARKER, size};
+    return serial_transport_send(header, sizeof(header)) && serial_transport_send(payload, size);
+}
+
+/**
+ * @brief Receive the rest of a pushed frame, whose marker was already read.
+ */
+static inline void receive_pushed_frame(void) {
+    uint8_t size = 0;
+    uint8_t payload[SPLIT_PUSH_MAX_SIZE];
+
+    if (unlikely(!serial_transport_receive(&size, sizeof(size)) || size > sizeof(payload) || !serial_transport_receive(payload, size))) {
+        serial_dprintf("SPLIT: receiving pushed frame failed\n");
+        transaction_push_received(NULL, 0);
+        return;
+    }
+
+    transaction_push_received(payload, size);
+}
+
+/**
+ * @brief Hand all frames the slave pushed so far to the split transactions.
+ */
+void soft_serial_initiator_receive_pushes(void) {
+    serial_link_lock_autounlock();
+
+    while (serial_transport_receive_ready()) {
+        uint8_t marker = 0;
+        if (unlikely(!serial_transport_receive(&marker, sizeof(marker)))) {
+            break;
+        }
+
+        if (likely(marker == SPLIT_PUSH_MARKER)) {
+            receive_pushed_frame();
+        } else {
+            /* A spurious byte, possibly what is left of a damaged frame. */
+            transaction_push_received(NULL, 0);
+        }
+    }
+}
+
+#endif
@@ -40,6 +40,11 @@ bool __attribute__((nonnull, hot)) serial_transport_receive(uint8_t* destination
  */
 bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* destination, const size_t size);
 
+/**
+ * @brief Non-blocking check whether received bytes are waiting to be read.
+ */
+bool serial_transport_receive_ready(void);
+
 /**
  * @brief Blocking send of buffer with timeout.
  *
@@ -47,3 +52,35 @@ bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* de
  * @return false Send failed, e.g. by timeout or bit errors.
  */
 bool __attribute__((nonnull, hot)) serial_transport_send(const uint8_t* source, const size_t size);
+
+#if defined(SERIAL_PIO_DMA) && defined(SERIAL_DRIVER_VENDOR) && defined(MCU_RP)
+#    define SERIAL_TRANSPORT_CHECKED
+#endif
+
+#if defined(SERIAL_TRANSPORT_CHECKED)
+/**
+ * @brief Blocking send of buffer with timeout, followed by a checksum the
+ * driver computes while sending.
+ *
+ * @return true Send success.
+ * @return false Send failed, e.g. by timeout.
+ */
+bool __attribute__((nonnull, hot)) serial_transport_send_checked(const uint8_t* source, const size_t size);
+
+/**
+ * @brief Blocking receive of size * bytes with timeout, checked against the
+ * checksum following them.
+ *
+ * @return true Receive success.
+ * @return false Receive failed, e.g. by timeout or a checksum mismatch.
+ */
+bool __attribute__((nonnull, hot)) serial_transport_receive_checked(uint8_t* destination, const size_t size);
+#endif
+
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+/**
+ * @brief Switches to SERIAL_USART_SPEED << step, after anything still being
+ * sent has left the wire.
+ */
+void serial_transport_set_speed_step(uint8_t step);
+#endif
@@ -71,6 +71,13 @@ inline void serial_transport_driver_clear(void) {
     }
 }
 
+inline bool serial_transport_receive_ready(void) {
+    osalSysLock();
+    bool ready = !iqIsEmptyI(&serial_driver->iqueue);
+    osalSysUnlock();
+    return ready;
+}
+
 #elif HAL_USE_SIO
 
 /**
@@ -91,12 +98,48 @@ inline void serial_transport_driver_clear(void) {
     osalSysUnlock();
 }
 
+inline bool serial_transport_receive_ready(void) {
+    osalSysLock();
+    bool ready = !sioIsRXEmptyX(serial_driver);
+    osalSysUnlock();
+    return ready;
+}
+
 #else
 
 #    error Either the SERIAL or SIO driver has to be activated to use the usart driver for split keyboards.
 
 #endif
 
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+void serial_transport_set_speed_step(uint8_t step) {
+#    if HAL_USE_SERIAL
+    /* Let the output queue drain, then give the last byte time to leave the shift register.
+     * A frame takes at most 12 bits, waiting a frame at a time keeps the switch short. */
+    sysinterval_t frame_time = TIME_US2I(12U * 1000000U / serial_config.speed);
+    osalSysLock();
+    bool volatile queue_not_empty = !oqIsEmptyI(&serial_driver->oqueue);
+    osalSysUnlock();
+    while (queue_not_empty) {
+        chThdSleep(frame_time);
+        osalSysLock();
+        queue_not_empty = !oqIsEmptyI(&serial_driver->oqueue);
+        osalSysUnlock();
+    }
+    chThdSleep(2 * frame_time);
+
+    sdStop(serial_driver);
+    serial_config.speed = (SERIAL_USART_SPEED) << step;
+#    else
+    (void)sioSynchronizeTXEnd(serial_driver, TIME_MS2I(SERIAL_USART_TIMEOUT));
+
+    sioStop(serial_driver);
+    serial_config.baud = (SERIAL_USART_SPEED) << step;
+#    endif
+    usart_driver_start();
+}
+#endif
+
 inline bool serial_transport_send(const uint8_t* source, const size_t size) {
     bool success = (size_t)chnWriteTimeout(serial_driver, source, size, TIME_MS2I(SERIAL_USART_TIMEOUT)) == size;
 
@@ -86,54 +86,74 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// Encode the next frame into one buffer while the other one is sent
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    if defined(WS2812_SPI_SYNC) || defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be used with WS2812_SPI_SYNC or WS2812_SPI_USE_CIRCULAR_BUFFER"
+#    endif
+#    define WS2812_SPI_BUFFERS 2
+#else
+#    define WS2812_SPI_BUFFERS 1
+#endif
+
+static uint8_t txbuf[WS2812_SPI_BUFFERS][PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+static uint8_t txbuf_index                                                       = 0;
+
+#if !defined(WS2812_SPI_SYNC) && !defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
+// Taken while a buffer is being sent
+static BSEMAPHORE_DECL(ws2812_spi_ready, false);
+
+static void ws2812_spi_complete(SPIDriver* spip) {
+    (void)spip;
+    osalSysLockFromISR();
+    chBSemSignalI(&ws2812_spi_ready);
+    osalSysUnlockFromISR();
+}
+#    define WS2812_SPI_COMPLETE_CB ws2812_spi_complete
+#else
+#    define WS2812_SPI_COMPLETE_CB NULL
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * the ws2812b protocol, every LED bit is sent as 0b1000 for a 0 and 0b1110
+ * for a 1. Each nibble of color data thus becomes two bytes, looked up here.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
+static const uint8_t ws2812_spi_nibble[16][2] = {
+    {0x88, 0x88}, {0x88, 0x8E}, {0x88, 0xE8}, {0x88, 0xEE}, // 0x0 - 0x3
+    {0x8E, 0x88}, {0x8E, 0x8E}, {0x8E, 0xE8}, {0x8E, 0xEE}, // 0x4 - 0x7
+    {0xE8, 0x88}, {0xE8, 0x8E}, {0xE8, 0xE8}, {0xE8, 0xEE}, // 0x8 - 0xB
+    {0xEE, 0x88}, {0xEE, 0x8E}, {0xEE, 0xE8}, {0xEE, 0xEE}, // 0xC - 0xF
+};
+
+static inline void set_led_byte(uint8_t* tx, uint8_t data) {
+    const uint8_t* high = ws2812_spi_nibble[data >> 4];
+    const uint8_t* low  = ws2812_spi_nibble[data & 0x0F];
+
+    tx[0] = high[0];
+    tx[1] = high[1];
+    tx[2] = low[0];
+    tx[3] = low[1];
 }
 
-static void set_led_color_rgb(LED_TYPE color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+static void set_led_color_rgb(uint8_t* tx_start, LED_TYPE color, int pos) {
+    uint8_t* tx = &tx_start[BYTES_FOR_LED * pos];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    set_led_byte(tx, color.g);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE, color.r);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
+    set_led_byte(tx, color.r);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE, color.g);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE * 2, color.b);
 #elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
+    set_led_byte(tx, color.b);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE, color.g);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE * 2, color.r);
 #endif
 #ifdef RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 4 + j] = get_protocol_eq(color.w, j);
+    set_led_byte(tx + BYTES_FOR_LED_BYTE * 3, color.w);
 #endif
 }
 
@@ -151,7 +171,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_COMPLETE_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,8 +190,8 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
-        NULL, // error_cb
+        WS2812_SPI_COMPLETE_CB, // data_cb
+        NULL,                   // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
         WS2812_SPI_DIVISOR_CR1_BR_X,
@@ -183,7 +203,7 @@ void ws2812_init(void) {
     spiStart(&WS2812_SPI, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI, ARRAY_SIZE(txbuf[0]), txbuf[0]);
 #endif
 }
 
@@ -194,17 +214,29 @@ void ws2812_setleds(LED_TYPE* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#if WS2812_SPI_BUFFERS == 1 && !defined(WS2812_SPI_SYNC) && !defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
+    // The only buffer may not be rewritten while it is still being sent
+    chBSemWait(&ws2812_spi_ready);
+#endif
+
+    uint8_t* tx = txbuf[txbuf_index];
     for (uint8_t i = 0; i < leds; i++) {
-        set_led_color_rgb(ledarray[i], i);
+        set_led_color_rgb(&tx[PREAMBLE_SIZE], ledarray[i], i);
     }
 
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
+    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms. With WS2812_SPI_DOUBLE_BUFFER the next
+    // frame is encoded into the other buffer meanwhile, otherwise it waits for this one to be sent.
+    // Instead spiSend can be used to send synchronously.
 #ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI, ARRAY_SIZE(txbuf[0]), tx);
 #    else
-    spiStartSend(&WS2812_SPI, ARRAY_SIZE(txbuf), txbuf);
+#        if WS2812_SPI_BUFFERS > 1
+    // Start once the other buffer has been sent
+    chBSemWait(&ws2812_spi_ready);
+#        endif
+    spiStartSend(&WS2812_SPI, ARRAY_SIZE(txbuf[0]), tx);
+    txbuf_index = (txbuf_index + 1) % WS2812_SPI_BUFFERS;
 #    endif
 #endif
 }
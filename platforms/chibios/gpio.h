@@ -43,3 +43,11 @@ typedef ioline_t pin_t;
 #define readPin(pin) palReadLine(pin)
 
 #define togglePin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port. */
+
+typedef ioportmask_t port_data_t;
+
+#define getPinPort(pin) ((uintptr_t)PAL_PORT(pin))
+#define getPinPortBit(pin) PAL_PAD(pin)
+#define readPort(pin) ((port_data_t)palReadPort(PAL_PORT(pin)))
@@ -13,11 +13,20 @@
 #include "led.h"
 #include "wait.h"
 
+#ifdef KEYEVENT_QUEUE_ENABLE
+#    include "keyevent_queue.h"
+#endif
+
 /** \brief suspend power down
  *
  * FIXME: needs doc
  */
 void suspend_power_down(void) {
+#ifdef KEYEVENT_QUEUE_ENABLE
+    // suspend_wakeup_condition() scans the matrix itself from here on
+    keyevent_queue_pause_scanning();
+    keyevent_queue_flush();
+#endif
     suspend_power_down_quantum();
     // on AVR, this enables the watchdog for 15ms (max), and goes to
     // SLEEP_MODE_PWR_DOWN
@@ -51,5 +60,11 @@ void suspend_wakeup_init(void) {
     host_consumer_send(0);
 #endif /* EXTRAKEY_ENABLE */
 
+#ifdef KEYEVENT_QUEUE_ENABLE
+    // Whatever was queued before or while suspended is stale
+    keyevent_queue_flush();
+    keyevent_queue_resume_scanning();
+#endif
+
     suspend_wakeup_init_quantum();
 }
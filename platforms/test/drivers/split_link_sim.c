@@ -0,0 +1,345 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "split_link_sim.h"
+#include "serial.h"
+#include "transactions.h"
+#include "transport.h"
+#include "timer.h"
+
+// Provided by the test platform timer
+void advance_time(uint32_t ms);
+
+static split_link_sim_config_t link_config = SPLIT_LINK_SIM_DEFAULT_CONFIG;
+static split_link_sim_stats_t  link_stats;
+static bool                    link_connected = true;
+static uint32_t                link_random    = 1;
+static uint32_t                elapsed_us     = 0; // not yet passed on to the timer
+static uint64_t                elapsed_ns     = 0; // not yet passed on as microseconds
+
+static split_shared_memory_t target_memory;
+static split_shared_memory_t swap_memory;
+static bool                  in_target = false;
+
+// Buffer sizes change at runtime, each half keeps its own table
+static split_transaction_desc_t initial_table[NUM_TOTAL_TRANSACTIONS];
+static split_transaction_desc_t target_table[NUM_TOTAL_TRANSACTIONS];
+static split_transaction_desc_t swap_table[NUM_TOTAL_TRANSACTIONS];
+
+// Set while the target waits for bytes of a transaction the initiator already finished
+static bool target_out_of_sync = false;
+
+#ifdef SPLIT_MATRIX_PUSH
+// Receive queue of the initiator, holding pushed frames until it reads them
+static uint8_t push_queue[4 * (2 + SPLIT_PUSH_MAX_SIZE)];
+static size_t  push_queued = 0;
+static uint8_t push_drops  = 0;
+#endif // SPLIT_MATRIX_PUSH
+
+static void enter_target(void) {
+    memcpy(&swap_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &target_memory, sizeof(split_shared_memory_t));
+    memcpy(swap_table, split_transaction_table, sizeof(swap_table));
+    memcpy(split_transaction_table, target_table, sizeof(target_table));
+    in_target = true;
+}
+
+static void leave_target(void) {
+    memcpy(&target_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &swap_memory, sizeof(split_shared_memory_t));
+    memcpy(target_table, split_transaction_table, sizeof(target_table));
+    memcpy(split_transaction_table, swap_table, sizeof(swap_table));
+    in_target = false;
+}
+
+// xorshift32, the same sequence of errors for the same seed
+static uint32_t next_random(void) {
+    link_random ^= link_random << 13;
+    link_random ^= link_random >> 17;
+    link_random ^= link_random << 5;
+    return link_random;
+}
+
+void split_link_sim_advance_us(uint32_t us) {
+    elapsed_us += us;
+    advance_time(elapsed_us / 1000);
+    elapsed_us %= 1000;
+}
+
+uint64_t split_link_sim_now_us(void) {
+    return (uint64_t)timer_read32() * 1000 + elapsed_us;
+}
+
+static void link_busy(uint32_t us) {
+    link_stats.busy_us += us;
+    split_link_sim_advance_us(us);
+}
+
+static void turn_around(void) {
+    link_busy(link_config.latency_us);
+}
+
+static void time_out(void) {
+    link_stats.failures++;
+    link_busy(link_config.timeout_ms * 1000);
+}
+
+/**
+ * \brief Moves bytes over the wire, flipping bits at the configured rate.
+ */
+static void transfer(uint8_t *destination, const uint8_t *source, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint8_t byte = source[i];
+        for (uint8_t bit = 0; link_config.bit_error_ppm && bit < 8; bit++) {
+            if (next_random() % 1000000 < link_config.bit_error_ppm) {
+                byte ^= 1 << bit;
+            }
+        }
+        if (byte != source[i]) {
+            link_stats.corrupted_bytes++;
+        }
+        destination[i] = byte;
+    }
+    link_stats.bytes += size;
+
+    elapsed_ns += (uint64_t)size * 10 * 1000000000 / link_config.baudrate;
+    link_busy(elapsed_ns / 1000);
+    elapsed_ns %= 1000;
+}
+
+void split_link_sim_configure(const split_link_sim_config_t *config) {
+    link_config = *config;
+    link_random = config->seed ? config->seed : 1;
+}
+
+void split_link_sim_init(const split_link_sim_config_t *config) {
+    static bool table_saved = false;
+    if (!table_saved) {
+        memcpy(initial_table, split_transaction_table, sizeof(initial_table));
+        table_saved = true;
+    }
+    memcpy(split_transaction_table, initial_table, sizeof(initial_table));
+    memcpy(target_table, initial_table, sizeof(initial_table));
+
+    split_link_sim_configure(config);
+    split_link_sim_clear_stats();
+    memset(&target_memory, 0, sizeof(target_memory));
+    target_out_of_sync = false;
+    link_connected     = true;
+#ifdef SPLIT_MATRIX_PUSH
+    push_queued = 0;
+    push_drops  = 0;
+#endif // SPLIT_MATRIX_PUSH
+    elapsed_us     = 0;
+    elapsed_ns     = 0;
+}
+
+void split_link_sim_set_connected(bool connected) {
+    link_connected = connected;
+}
+
+bool split_link_sim_is_target(void) {
+    return in_target;
+}
+
+void split_link_sim_drop_pushes(uint8_t count) {
+#ifdef SPLIT_MATRIX_PUSH
+    push_drops = count;
+#endif // SPLIT_MATRIX_PUSH
+}
+
+void split_link_sim_target_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    enter_target();
+    transport_slave(master_matrix, slave_matrix);
+    leave_target();
+}
+
+const split_link_sim_stats_t *split_link_sim_get_stats(void) {
+    return &link_stats;
+}
+
+void split_link_sim_clear_stats(void) {
+    memset(&link_stats, 0, sizeof(link_stats));
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+/**
+ * \brief Bytes the target takes for the buffer of a transaction, judged by its own table.
+ *
+ * Returns 0 for a length prefix the target drops.
+ */
+static size_t target_buffer_length(uint8_t id, const uint8_t *buffer) {
+    size_t size = target_table[id].initiator2target_buffer_size;
+    if (size && split_transaction_is_length_prefixed(id)) {
+        return buffer[0] < size ? 1 + buffer[0] : 0;
+    }
+    return size;
+}
+
+/**
+ * \brief Hands the bytes the initiator sent beyond the end of a transaction to the target.
+ *
+ * The target takes the first of them for a transaction id. An invalid one
+ * makes it clear its receive queue. For a valid one it answers a handshake
+ * nobody waits for and reads whatever follows as the buffer, so the next
+ * handshake of the initiator is lost.
+ */
+static void receive_stray_bytes(const uint8_t *bytes, size_t count) {
+    link_stats.stray_bytes += count;
+    if (count && bytes[0] < NUM_TOTAL_TRANSACTIONS) {
+        target_out_of_sync = true;
+    }
+}
+
+/**
+ * \brief Runs a transaction the way serial_protocol.c does, byte for byte.
+ *
+ * Both halves size buffers from their own transaction table, so a buffer
+ * that is longer or shorter on the initiator than on the target goes wrong
+ * the way it does on the wire.
+ */
+bool soft_serial_transaction(int sstd_index) {
+    link_stats.transactions++;
+    link_stats.transactions_by_id[sstd_index]++;
+    if (!link_connected) {
+        time_out();
+        return false;
+    }
+
+#ifdef SPLIT_MATRIX_PUSH
+    // Pushed frames arrive ahead of the handshake
+    soft_serial_initiator_receive_pushes();
+#endif // SPLIT_MATRIX_PUSH
+
+    // The target still waits for the rest of an earlier transaction and takes the handshake as part of it
+    if (target_out_of_sync) {
+        target_out_of_sync = false;
+        time_out();
+        return false;
+    }
+
+    split_transaction_desc_t *trans  = &split_transaction_table[sstd_index];
+    split_transaction_desc_t *target = &target_table[sstd_index];
+
+    // The transaction id is answered XORed, a garbled id is ignored by the target
+    uint8_t id = (uint8_t)sstd_index;
+    transfer(&id, &id, 1);
+    if (id >= NUM_TOTAL_TRANSACTIONS) {
+        time_out();
+        return false;
+    }
+    turn_around();
+    uint8_t shake = id ^ NUM_TOTAL_TRANSACTIONS;
+    transfer(&shake, &shake, 1);
+    if (shake != (sstd_index ^ NUM_TOTAL_TRANSACTIONS)) {
+        link_stats.failures++;
+        return false;
+    }
+    turn_around();
+
+    // The initiator always sends its whole buffer, the target only reads as much as it expects
+    uint8_t wire[256];
+    size_t  sent = trans->initiator2target_buffer_size;
+    transfer(wire, split_trans_initiator2target_buffer(trans), sent);
+
+    uint8_t *i2t_target = (uint8_t *)&target_memory + target->initiator2target_offset;
+    size_t   expected   = sent ? target_buffer_length(sstd_index, wire) : target->initiator2target_buffer_size;
+    if (target->initiator2target_buffer_size && expected == 0) {
+        // The target drops a buffer whose length prefix does not fit, and clears its queue
+        i2t_target[0] = 0;
+        if (target->target2initiator_buffer_size) {
+            time_out();
+            return false;
+        }
+        // Nothing to wait for, so the initiator cannot tell
+        link_stats.failures++;
+        return true;
+    }
+    if (sent < expected) {
+        memcpy(i2t_target, wire, sent);
+        if (target->target2initiator_buffer_size) {
+            time_out();
+            return false;
+        }
+        // Nothing to wait for, so the initiator cannot tell
+        target_out_of_sync = true;
+        return true;
+    }
+    memcpy(i2t_target, wire, expected);
+
+    if (target->slave_callback) {
+        enter_target();
+        target->slave_callback(target->initiator2target_buffer_size, split_trans_initiator2target_buffer(target), target->target2initiator_buffer_size, split_trans_target2initiator_buffer(target));
+        leave_target();
+    }
+
+    if (trans->target2initiator_buffer_size) {
+        turn_around();
+        transfer(split_trans_target2initiator_buffer(trans), (uint8_t *)&target_memory + target->target2initiator_offset, trans->target2initiator_buffer_size);
+    }
+
+    receive_stray_bytes(wire + expected, sent - expected);
+    return true;
+}
+
+#ifdef SPLIT_MATRIX_PUSH
+
+/**
+ * \brief Sends a frame the way serial_protocol.c does, into the receive queue of the initiator.
+ *
+ * The target cannot tell whether anybody received it.
+ */
+bool soft_serial_target_push(const uint8_t *payload, uint8_t size) {
+    link_stats.pushes++;
+    if (!link_connected) {
+        return true;
+    }
+
+    uint8_t frame[2 + SPLIT_PUSH_MAX_SIZE] = {SPLIT_PUSH_MARKER, size};
+    uint8_t wire[sizeof(frame)];
+    memcpy(&frame[2], payload, size);
+    transfer(wire, frame, 2 + size);
+
+    if (push_drops) {
+        push_drops--;
+        link_stats.failures++;
+        return true;
+    }
+    if (push_queued + 2 + size > sizeof(push_queue)) {
+        // The receive queue overflows
+        link_stats.failures++;
+        return true;
+    }
+    memcpy(&push_queue[push_queued], wire, 2 + size);
+    push_queued += 2 + size;
+    return true;
+}
+
+/**
+ * \brief Hands the queued frames to the split transactions the way serial_protocol.c does.
+ */
+void soft_serial_initiator_receive_pushes(void) {
+    size_t at = 0;
+    while (at < push_queued) {
+        if (push_queue[at] != SPLIT_PUSH_MARKER) {
+            // A spurious byte, possibly what is left of a damaged frame
+            transaction_push_received(NULL, 0);
+            at++;
+            continue;
+        }
+        if (at + 2 > push_queued || push_queue[at + 1] > SPLIT_PUSH_MAX_SIZE || at + 2 + push_queue[at + 1] > push_queued) {
+            // Waiting for the rest times out, and takes the queue with it
+            transaction_push_received(NULL, 0);
+            break;
+        }
+        transaction_push_received(&push_queue[at + 2], push_queue[at + 1]);
+        at += 2 + push_queue[at + 1];
+    }
+    push_queued = 0;
+}
+
+#endif // SPLIT_MATRIX_PUSH
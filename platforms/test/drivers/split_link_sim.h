@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Emulated serial link between the two halves of a split keyboard.
+
+    Implements the soft_serial_* transport of drivers/serial.h for the test
+    platform. The initiator runs the regular split code against
+    split_shmem, the target against a shared memory image of its own, which
+    is swapped in while target code runs. Every transaction moves the same
+    bytes the serial protocol would, at the configured baudrate and
+    latency, through a generator of bit errors. Each half sizes buffers
+    from its own transaction table, as the real halves do. Frames pushed by
+    the target wait in the receive queue of the initiator until it reads
+    pushes or starts a transaction. Time passes on the test
+    platform timer, so throughput and latencies come out in emulated time
+    and are the same on every run.
+
+    Only the shared memory and the transaction table are separate, the
+    target shares all other state of the split code with the initiator.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+#include "transaction_id_define.h"
+
+typedef struct {
+    uint32_t baudrate;      // bits per second, every byte takes 10 bits on the wire
+    uint32_t latency_us;    // added every time the link turns around
+    uint32_t bit_error_ppm; // data bits flipped per million
+    uint32_t timeout_ms;    // the initiator waits this long for a reply that does not come
+    uint32_t seed;          // of the bit error generator, nonzero
+} split_link_sim_config_t;
+
+typedef struct {
+    uint32_t transactions;    // started by the initiator
+    uint32_t transactions_by_id[NUM_TOTAL_TRANSACTIONS];
+    uint32_t failures;        // failed handshakes, timeouts and dropped buffers
+    uint32_t bytes;           // moved over the link in either direction
+    uint32_t corrupted_bytes; // with at least one flipped bit
+    uint32_t stray_bytes;     // sent by the initiator beyond what the target expected
+    uint32_t pushes;          // frames pushed by the target, with SPLIT_MATRIX_PUSH
+    uint64_t busy_us;         // spent on the link, including timeouts
+} split_link_sim_stats_t;
+
+#define SPLIT_LINK_SIM_DEFAULT_CONFIG \
+    { .baudrate = 921600, .latency_us = 5, .bit_error_ppm = 0, .timeout_ms = 20, .seed = 1 }
+
+/** \brief Resets the link, its statistics, the target shared memory and both transaction tables. */
+void split_link_sim_init(const split_link_sim_config_t *config);
+
+/** \brief Changes the link parameters, keeping statistics and state. */
+void split_link_sim_configure(const split_link_sim_config_t *config);
+
+/** \brief Unplugs or plugs the cable, all transactions time out while unplugged. */
+void split_link_sim_set_connected(bool connected);
+
+/** \brief Loses the next count frames pushed by the target, with SPLIT_MATRIX_PUSH. */
+void split_link_sim_drop_pushes(uint8_t count);
+
+/** \brief Runs the split code of a target scan against the target shared memory. */
+void split_link_sim_target_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+/** \brief True while code runs on behalf of the target. */
+bool split_link_sim_is_target(void);
+
+/** \brief Lets time pass with a resolution of microseconds. */
+void split_link_sim_advance_us(uint32_t us);
+
+/** \brief Emulated time in microseconds, following the test platform timer. */
+uint64_t split_link_sim_now_us(void);
+
+const split_link_sim_stats_t *split_link_sim_get_stats(void);
+void                          split_link_sim_clear_stats(void);
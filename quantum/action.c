@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "keycode_config.h"
 #include "debug.h"
 #include "quantum.h"
+#include "stage_probe.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -271,7 +272,11 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
-    if (!process_record_quantum(record)) {
+    STAGE_PROBE_BEGIN_ARG(STAGE_PROCESS_RECORD, (uint16_t)record->event.key.row << 8 | record->event.key.col);
+    const bool continue_processing = process_record_quantum(record);
+    STAGE_PROBE_END_ARG(STAGE_PROCESS_RECORD, continue_processing);
+
+    if (!continue_processing) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
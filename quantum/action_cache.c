@@ -0,0 +1,58 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "action_cache.h"
+#include "keycode_config.h"
+#include "matrix.h"
+
+#ifndef ACTION_CACHE_LAYERS
+#    ifdef DYNAMIC_KEYMAP_LAYER_COUNT
+#        define ACTION_CACHE_LAYERS DYNAMIC_KEYMAP_LAYER_COUNT
+#    else
+#        define ACTION_CACHE_LAYERS 4
+#    endif
+#endif
+
+extern keymap_config_t keymap_config;
+
+static action_t     action_cache[ACTION_CACHE_LAYERS][MATRIX_ROWS][MATRIX_COLS];
+static matrix_row_t action_cache_valid[ACTION_CACHE_LAYERS][MATRIX_ROWS];
+// Resolved actions depend on the magic keycode settings, a change there drops the cache
+static uint16_t action_cache_keymap_config;
+
+static inline bool action_cache_contains(uint8_t layer, keypos_t key) {
+    return layer < ACTION_CACHE_LAYERS && key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+bool action_cache_get(uint8_t layer, keypos_t key, action_t *action) {
+    if (!action_cache_contains(layer, key)) {
+        return false;
+    }
+
+    if (action_cache_keymap_config != keymap_config.raw) {
+        action_cache_invalidate();
+        return false;
+    }
+
+    if (!(action_cache_valid[layer][key.row] & ((matrix_row_t)1 << key.col))) {
+        return false;
+    }
+
+    *action = action_cache[layer][key.row][key.col];
+    return true;
+}
+
+void action_cache_set(uint8_t layer, keypos_t key, action_t action) {
+    if (!action_cache_contains(layer, key)) {
+        return;
+    }
+
+    action_cache[layer][key.row][key.col] = action;
+    action_cache_valid[layer][key.row] |= (matrix_row_t)1 << key.col;
+}
+
+void action_cache_invalidate(void) {
+    memset(action_cache_valid, 0, sizeof(action_cache_valid));
+    action_cache_keymap_config = keymap_config.raw;
+}
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "action.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Looks up the resolved action for a key on a layer.
+ *
+ * @param layer[in] the layer to look on
+ * @param key[in] the matrix position
+ * @param action[out] the cached action, when found
+ * @return true if the action was cached
+ */
+bool action_cache_get(uint8_t layer, keypos_t key, action_t *action);
+
+/**
+ * @brief Stores the resolved action for a key on a layer. Positions outside the cache are ignored.
+ */
+void action_cache_set(uint8_t layer, keypos_t key, action_t action);
+
+/**
+ * @brief Drops every cached action.
+ *
+ * Called whenever the keymap changes underneath the cache, such as dynamic keymap writes. Call it from
+ * keyboard or user code whose keymap_key_to_keycode() override returns different keycodes over time.
+ */
+void action_cache_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,7 @@
 
 /*
     This API allows for basic profiling information to be printed out over console.
+    For per-stage timelines of the main loop, see PERF_TRACE_ENABLE (perf_trace.h).
 
     Usage example:
 
@@ -43,6 +43,10 @@ static const crc_t crc_table[256] = {
     0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3  //
 };
 
+static inline crc_t crc8_byte(crc_t crc, uint8_t byte) {
+    return crc_table[crc ^ byte] & 0xff;
+}
+
 __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
     const uint8_t *d   = (const uint8_t *)data;
     crc_t          crc = 0xff;
@@ -56,6 +60,17 @@ __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
     return crc & 0xff;
 }
 #else
+static inline crc_t crc8_byte(crc_t crc, uint8_t byte) {
+    crc ^= byte;
+    for (size_t j = 0; j < 8; j++) {
+        if ((crc & 0x80) != 0)
+            crc = (crc_t)((crc << 1) ^ 0x31);
+        else
+            crc <<= 1;
+    }
+    return crc;
+}
+
 __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
     const uint8_t *d   = (const uint8_t *)data;
     crc_t          crc = 0xff;
@@ -73,3 +88,15 @@ __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
     return crc;
 }
 #endif
+
+uint8_t crc8_copy(void *dest, const void *src, size_t data_len) {
+    uint8_t       *d   = (uint8_t *)dest;
+    const uint8_t *s   = (const uint8_t *)src;
+    crc_t          crc = 0xff;
+
+    while (data_len--) {
+        crc = crc8_byte(crc, *s);
+        *d++ = *s++;
+    }
+    return crc & 0xff;
+}
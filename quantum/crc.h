@@ -43,3 +43,16 @@ __attribute__((weak)) void crc_init(void);
  * \return             The calculated crc value.
  */
 __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len);
+
+/**
+ * Copy a buffer and generate its CRC8 value in the same pass.
+ *
+ * Gives the same value as the built-in crc8(), so a platform that replaces
+ * crc8() with a different algorithm cannot mix the two.
+ *
+ * \param[out] dest     Pointer to a buffer of \a data_len bytes to copy to.
+ * \param[in]  src      Pointer to a buffer of \a data_len bytes to copy from.
+ * \param[in]  data_len Number of bytes to copy.
+ * \return              The calculated crc value of the copied data.
+ */
+uint8_t crc8_copy(void *dest, const void *src, size_t data_len);
@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+}
+
+class Crc8Copy : public ::testing::Test {
+   protected:
+    uint8_t src[64];
+    uint8_t dest[sizeof(src) + 1];
+
+    void SetUp() override {
+        for (size_t i = 0; i < sizeof(src); i++) {
+            src[i] = i * 37 + 11;
+        }
+        memset(dest, 0xA5, sizeof(dest));
+    }
+};
+
+TEST_F(Crc8Copy, MatchesCrc8) {
+    for (size_t length = 1; length <= sizeof(src); length++) {
+        EXPECT_EQ(crc8_copy(dest, src, length), crc8(src, length)) << "length " << length;
+    }
+}
+
+TEST_F(Crc8Copy, CopiesExactlyTheLength) {
+    crc8_copy(dest, src, sizeof(src) - 1);
+
+    EXPECT_EQ(memcmp(dest, src, sizeof(src) - 1), 0);
+    EXPECT_EQ(dest[sizeof(src) - 1], 0xA5);
+    EXPECT_EQ(dest[sizeof(src)], 0xA5);
+}
+
+TEST_F(Crc8Copy, NothingToCopy) {
+    EXPECT_EQ(crc8_copy(dest, src, 0), crc8(src, 0));
+    EXPECT_EQ(dest[0], 0xA5);
+}
+
+TEST_F(Crc8Copy, DetectsAChangedByte) {
+    uint8_t checksum = crc8_copy(dest, src, sizeof(src));
+
+    dest[sizeof(src) / 2] ^= 0x01;
+    EXPECT_NE(crc8(dest, sizeof(src)), checksum);
+}
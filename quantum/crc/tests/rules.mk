@@ -0,0 +1,6 @@
+crc_SRC := \
+	$(QUANTUM_PATH)/crc/tests/crc_tests.cpp \
+	$(QUANTUM_PATH)/crc.c
+
+crc_table_DEFS := -DCRC8_USE_TABLE
+crc_table_SRC := $(crc_SRC)
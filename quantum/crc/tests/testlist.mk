@@ -0,0 +1,3 @@
+TEST_LIST += \
+	crc \
+	crc_table
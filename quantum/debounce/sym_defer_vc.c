@@ -0,0 +1,161 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters.
+Behaves like sym_defer_pk, but each key's remaining debounce time is stored as
+one bit in each of a few bit-planes per row. A whole row of counters is then
+started, decremented and expired with a handful of bitwise operations, without
+looping over columns or allocating memory.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+// Enough bit-planes to hold DEBOUNCE
+#if DEBOUNCE < 2
+#    define DEBOUNCE_PLANES 1
+#elif DEBOUNCE < 4
+#    define DEBOUNCE_PLANES 2
+#elif DEBOUNCE < 8
+#    define DEBOUNCE_PLANES 3
+#elif DEBOUNCE < 16
+#    define DEBOUNCE_PLANES 4
+#elif DEBOUNCE < 32
+#    define DEBOUNCE_PLANES 5
+#elif DEBOUNCE < 64
+#    define DEBOUNCE_PLANES 6
+#elif DEBOUNCE < 128
+#    define DEBOUNCE_PLANES 7
+#else
+#    define DEBOUNCE_PLANES 8
+#endif
+
+#if DEBOUNCE > 0
+// Bit `col` of planes[bit][row] is bit `bit` of that key's remaining time, zero when not debouncing
+static matrix_row_t debounce_planes[DEBOUNCE_PLANES][MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+        for (uint8_t row = 0; row < num_rows; row++) {
+            debounce_planes[bit][row] = 0;
+        }
+    }
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t active = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            active |= debounce_planes[bit][row];
+        }
+        if (!active) {
+            continue;
+        }
+
+        matrix_row_t expired = active;
+        if (elapsed_time < DEBOUNCE) {
+            // Subtract elapsed_time from every counter in the row at once, a borrow out of the top plane means it expired
+            matrix_row_t borrow    = 0;
+            matrix_row_t remaining = 0;
+            for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+                matrix_row_t counter  = debounce_planes[bit][row];
+                matrix_row_t subtract = (elapsed_time & (1 << bit)) ? active : 0;
+
+                debounce_planes[bit][row] = counter ^ subtract ^ borrow;
+                borrow                    = (~counter & (subtract | borrow)) | (subtract & borrow);
+                remaining |= debounce_planes[bit][row];
+            }
+            expired = active & (borrow | ~remaining);
+        }
+
+        if (expired) {
+            for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+                debounce_planes[bit][row] &= ~expired;
+            }
+
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta  = raw[row] ^ cooked[row];
+        matrix_row_t active = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            active |= debounce_planes[bit][row];
+        }
+
+        // Keys back at their cooked state stop debouncing, newly changed keys start at DEBOUNCE
+        matrix_row_t start = delta & ~active;
+        for (uint8_t bit = 0; bit < DEBOUNCE_PLANES; bit++) {
+            debounce_planes[bit][row] = (debounce_planes[bit][row] & delta) | ((DEBOUNCE & (1 << bit)) ? start : 0);
+        }
+
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+/* Times debounce() over a synthetic typing run, built into every algorithm's suite so the results can be compared */
+TEST(DebounceBenchmark, Typing) {
+    const int    scans          = 200000;
+    const int    scans_per_ms   = 4;
+    const int    press_interval = 37; // ms between key changes
+    const int    bounce_scans   = 3;
+    matrix_row_t raw[MATRIX_ROWS]    = {0};
+    matrix_row_t cooked[MATRIX_ROWS] = {0};
+    uint32_t     lcg                 = 12345;
+    int          bouncing            = 0;
+    uint8_t      row = 0, col = 0;
+
+    debounce_init(MATRIX_ROWS);
+    set_time(7777);
+
+    std::chrono::nanoseconds total(0);
+    for (int scan = 0; scan < scans; scan++) {
+        bool changed = false;
+        if (scan % (press_interval * scans_per_ms) == 0) {
+            lcg      = lcg * 1103515245 + 12345;
+            row      = (lcg >> 16) % MATRIX_ROWS;
+            col      = (lcg >> 20) % MATRIX_COLS;
+            bouncing = bounce_scans * 2 + 1;
+        }
+        if (bouncing > 0) {
+            raw[row] ^= (matrix_row_t)1 << col;
+            bouncing--;
+            changed = true;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        debounce(raw, cooked, MATRIX_ROWS, changed);
+        total += std::chrono::steady_clock::now() - start;
+
+        if (scan % scans_per_ms == scans_per_ms - 1) {
+            advance_time(1);
+        }
+    }
+
+    /* Let everything settle, the cooked matrix must end up matching the raw one */
+    for (int i = 0; i < 1000; i++) {
+        debounce(raw, cooked, MATRIX_ROWS, false);
+        advance_time(1);
+    }
+    for (uint8_t r = 0; r < MATRIX_ROWS; r++) {
+        EXPECT_EQ(raw[r], cooked[r]) << "row " << (int)r;
+    }
+
+    debounce_free();
+
+    double ns_per_scan = (double)total.count() / scans;
+    printf("debounce(): %.1f ns/scan over %d scans\n", ns_per_scan, scans);
+    RecordProperty("ns_per_scan", (int)ns_per_scan);
+}
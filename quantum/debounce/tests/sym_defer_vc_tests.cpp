@@ -0,0 +1,63 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* sym_defer_vc is also run against sym_defer_pk_tests.cpp, these cover keys sharing a row and plane arithmetic */
+
+TEST_F(DebounceTest, VcSameRowIndependentTimers) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {2, {{0, 2, DOWN}}, {}},
+        {3, {{0, 9, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {7, {}, {{0, 2, DOWN}}},
+        {8, {}, {{0, 9, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VcSameRowBounceRestartsOnlyThatKey) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {0, 2, DOWN}}, {}},
+        /* Key 2 bounces */
+        {3, {{0, 2, UP}}, {}},
+        {4, {{0, 2, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {9, {}, {{0, 2, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VcAllKeysAllRows) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}, {1, 3, DOWN}, {2, 6, DOWN}, {3, 9, DOWN}}, {}},
+        {1, {{0, 9, DOWN}, {3, 0, DOWN}}, {}},
+
+        {5, {}, {{0, 0, DOWN}, {1, 3, DOWN}, {2, 6, DOWN}, {3, 9, DOWN}}},
+        {6, {{0, 0, UP}, {1, 3, UP}}, {{0, 9, DOWN}, {3, 0, DOWN}}},
+
+        {11, {}, {{0, 0, UP}, {1, 3, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VcPartialElapsedTime) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{1, 4, DOWN}}, {}},
+        /* Scans 3ms apart leave 2ms, then borrow past zero */
+        {3, {{2, 4, DOWN}}, {}},
+        {6, {}, {{1, 4, DOWN}}},
+        {9, {}, {{2, 4, DOWN}}},
+    });
+    time_jumps_ = true;
+    runEvents();
+}
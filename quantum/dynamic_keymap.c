@@ -22,6 +22,10 @@
 #include "send_string.h"
 #include "keycodes.h"
 
+#ifdef ACTION_CACHE_ENABLE
+#    include "action_cache.h"
+#endif
+
 #ifdef VIA_ENABLE
 #    include "via.h"
 #    define DYNAMIC_KEYMAP_EEPROM_START (VIA_EEPROM_CONFIG_END)
@@ -101,6 +105,118 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include <string.h>
+#    include "timer.h"
+#    include "util.h"
+
+#    define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#    else
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#    endif
+#    define DYNAMIC_KEYMAP_MIRROR_SIZE (DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODER_SIZE)
+
+// Time without further changes before dirty blocks are written back
+#    ifndef DYNAMIC_KEYMAP_WRITE_BACK_DELAY
+#        define DYNAMIC_KEYMAP_WRITE_BACK_DELAY 1000
+#    endif
+
+// Bytes written back per call to dynamic_keymap_task()
+#    ifndef DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE
+#        define DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE 32
+#    endif
+
+#    define DYNAMIC_KEYMAP_MIRROR_BLOCKS ((DYNAMIC_KEYMAP_MIRROR_SIZE + DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE - 1) / DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE)
+
+// Keymap followed by the encoder map, in the same big-endian layout as EEPROM
+static uint8_t  dynamic_keymap_mirror[DYNAMIC_KEYMAP_MIRROR_SIZE];
+static uint8_t  dynamic_keymap_mirror_dirty[(DYNAMIC_KEYMAP_MIRROR_BLOCKS + 7) / 8];
+static bool     dynamic_keymap_mirror_loaded  = false;
+static bool     dynamic_keymap_mirror_pending = false;
+static uint16_t dynamic_keymap_mirror_last_change;
+
+static uint8_t *dynamic_keymap_mirror_data(void) {
+    if (!dynamic_keymap_mirror_loaded) {
+        eeprom_read_block(dynamic_keymap_mirror, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+        eeprom_read_block(dynamic_keymap_mirror + DYNAMIC_KEYMAP_KEYMAP_SIZE, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_ENCODER_SIZE);
+#    endif // ENCODER_MAP_ENABLE
+        dynamic_keymap_mirror_loaded = true;
+    }
+    return dynamic_keymap_mirror;
+}
+
+static void dynamic_keymap_mirror_mark_dirty(uint16_t offset, uint16_t size) {
+    for (uint16_t block = offset / DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE; block <= (offset + size - 1) / DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE; block++) {
+        dynamic_keymap_mirror_dirty[block / 8] |= 1 << (block % 8);
+    }
+    dynamic_keymap_mirror_pending     = true;
+    dynamic_keymap_mirror_last_change = timer_read();
+}
+
+static uint16_t dynamic_keymap_mirror_read(uint16_t offset) {
+    const uint8_t *mirror = dynamic_keymap_mirror_data();
+    return ((uint16_t)mirror[offset] << 8) | mirror[offset + 1];
+}
+
+static void dynamic_keymap_mirror_write(uint16_t offset, uint16_t keycode) {
+    uint8_t *mirror = dynamic_keymap_mirror_data();
+    if (mirror[offset] == (uint8_t)(keycode >> 8) && mirror[offset + 1] == (uint8_t)(keycode & 0xFF)) {
+        return;
+    }
+    mirror[offset]     = (uint8_t)(keycode >> 8);
+    mirror[offset + 1] = (uint8_t)(keycode & 0xFF);
+    dynamic_keymap_mirror_mark_dirty(offset, 2);
+}
+
+static void dynamic_keymap_mirror_write_back(uint16_t block) {
+    uint16_t start = block * DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE;
+    uint16_t end   = MIN(start + DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE, DYNAMIC_KEYMAP_MIRROR_SIZE);
+
+    dynamic_keymap_mirror_dirty[block / 8] &= ~(1 << (block % 8));
+    // A block may straddle the end of the keymap, the encoder map need not follow it in EEPROM
+    if (start < DYNAMIC_KEYMAP_KEYMAP_SIZE) {
+        uint16_t keymap_end = MIN(end, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+        eeprom_update_block(&dynamic_keymap_mirror[start], ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + start, keymap_end - start);
+        start = keymap_end;
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    if (start < end) {
+        eeprom_update_block(&dynamic_keymap_mirror[start], ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + start - DYNAMIC_KEYMAP_KEYMAP_SIZE, end - start);
+    }
+#    endif // ENCODER_MAP_ENABLE
+}
+
+static bool dynamic_keymap_mirror_write_back_next(void) {
+    for (uint16_t block = 0; block < DYNAMIC_KEYMAP_MIRROR_BLOCKS; block++) {
+        if (dynamic_keymap_mirror_dirty[block / 8] & (1 << (block % 8))) {
+            dynamic_keymap_mirror_write_back(block);
+            return true;
+        }
+    }
+    dynamic_keymap_mirror_pending = false;
+    return false;
+}
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
+void dynamic_keymap_task(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (!dynamic_keymap_mirror_pending || timer_elapsed(dynamic_keymap_mirror_last_change) < DYNAMIC_KEYMAP_WRITE_BACK_DELAY) {
+        return;
+    }
+    dynamic_keymap_mirror_write_back_next();
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
+void dynamic_keymap_flush(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    while (dynamic_keymap_mirror_pending && dynamic_keymap_mirror_write_back_next()) {
+    }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +228,30 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    return dynamic_keymap_mirror_read(((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_write(((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2, keycode);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+#ifdef ACTION_CACHE_ENABLE
+    action_cache_invalidate();
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,19 +261,27 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    return dynamic_keymap_mirror_read(DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS + encoder_id) * 2 * 2 + (clockwise ? 0 : 2));
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_write(DYNAMIC_KEYMAP_KEYMAP_SIZE + (layer * NUM_ENCODERS + encoder_id) * 2 * 2 + (clockwise ? 0 : 2), keycode);
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -165,10 +300,24 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    // The backing store may have just been erased, so rewrite all of it, and
+    // before returning so a VIA valid flag set afterwards cannot outlive it.
+    dynamic_keymap_mirror_mark_dirty(0, DYNAMIC_KEYMAP_MIRROR_SIZE);
+    dynamic_keymap_flush();
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    const uint8_t *mirror = dynamic_keymap_mirror_data();
+    uint16_t       count  = offset < dynamic_keymap_eeprom_size ? MIN(size, dynamic_keymap_eeprom_size - offset) : 0;
+    if (count > 0) {
+        memcpy(data, &mirror[offset], count);
+    }
+    memset(data + count, 0x00, size - count);
+#else
     void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
@@ -180,10 +329,20 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint8_t *mirror = dynamic_keymap_mirror_data();
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < dynamic_keymap_eeprom_size && mirror[offset + i] != data[i]) {
+            mirror[offset + i] = data[i];
+            dynamic_keymap_mirror_mark_dirty(offset + i, 1);
+        }
+    }
+#else
     void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
@@ -193,6 +352,10 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+#ifdef ACTION_CACHE_ENABLE
+    action_cache_invalidate();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +383,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +397,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 8
+
+// Backs platforms/test/eeprom.c through EEPROM_CUSTOM
+#define EEPROM_SIZE 1024
@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The EEPROM layout is checked in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+// Defaults of dynamic_keymap.c
+#define DYNAMIC_KEYMAP_WRITE_BACK_DELAY 1000
+#define DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE 32
+
+#define KEYMAP_SIZE (4 * MATRIX_ROWS * MATRIX_COLS * 2)
+// Rows that share a write back block
+#define ROWS_PER_BLOCK (DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE / (MATRIX_COLS * 2))
+
+class DynamicKeymapMirror : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // The mirror outlives a test, start from one that matches EEPROM
+        dynamic_keymap_flush();
+    }
+
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+
+    void set_eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+        uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        eeprom_write_byte(address, keycode >> 8);
+        eeprom_write_byte(address + 1, keycode & 0xFF);
+    }
+};
+
+// The mirror is loaded once per binary, so this has to run first
+TEST_F(DynamicKeymapMirror, LoadsFromEepromOnFirstUse) {
+    set_eeprom_keycode(1, 2, 3, 0x1234);
+    set_eeprom_keycode(3, 3, 7, 0xABCD);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 3, 7), 0xABCD);
+
+    uint8_t buffer[2];
+    dynamic_keymap_get_buffer(((1 * MATRIX_ROWS + 2) * MATRIX_COLS + 3) * 2, sizeof(buffer), buffer);
+    EXPECT_EQ(buffer[0], 0x12);
+    EXPECT_EQ(buffer[1], 0x34);
+
+    // Served from RAM from now on
+    set_eeprom_keycode(1, 2, 3, 0x5678);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x1234);
+    set_eeprom_keycode(1, 2, 3, 0x1234);
+}
+
+TEST_F(DynamicKeymapMirror, ChangeIsWrittenBackAfterTheDelay) {
+    dynamic_keymap_set_keycode(0, 0, 0, 0x0004);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0x0004);
+
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY - 1);
+    dynamic_keymap_task();
+    EXPECT_NE(eeprom_keycode(0, 0, 0), 0x0004);
+
+    advance_time(1);
+    dynamic_keymap_task();
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), 0x0004);
+}
+
+TEST_F(DynamicKeymapMirror, FurtherChangesPostponeTheWriteBack) {
+    dynamic_keymap_set_keycode(0, 1, 0, 0x0005);
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+    dynamic_keymap_set_keycode(0, 1, 1, 0x0006);
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+    dynamic_keymap_task();
+    EXPECT_NE(eeprom_keycode(0, 1, 0), 0x0005);
+
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+    dynamic_keymap_task();
+    EXPECT_EQ(eeprom_keycode(0, 1, 0), 0x0005);
+    EXPECT_EQ(eeprom_keycode(0, 1, 1), 0x0006);
+}
+
+TEST_F(DynamicKeymapMirror, TaskWritesOneBlockPerCall) {
+    dynamic_keymap_set_keycode(1, 0, 0, 0x0007);
+    dynamic_keymap_set_keycode(1, ROWS_PER_BLOCK, 0, 0x0008);
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY);
+
+    dynamic_keymap_task();
+    EXPECT_EQ(eeprom_keycode(1, 0, 0), 0x0007);
+    EXPECT_NE(eeprom_keycode(1, ROWS_PER_BLOCK, 0), 0x0008);
+
+    dynamic_keymap_task();
+    EXPECT_EQ(eeprom_keycode(1, ROWS_PER_BLOCK, 0), 0x0008);
+}
+
+TEST_F(DynamicKeymapMirror, OnlyChangedBlocksAreWritten) {
+    // Out of step with the mirror, so a write of its block would overwrite it
+    uint16_t keycode = eeprom_keycode(2, 2, 0);
+    set_eeprom_keycode(2, 2, 0, 0xBEEF);
+
+    dynamic_keymap_set_keycode(2, 0, 0, 0x0009);
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(2, 0, 0), 0x0009);
+    EXPECT_EQ(eeprom_keycode(2, 2, 0), 0xBEEF);
+
+    set_eeprom_keycode(2, 2, 0, keycode);
+}
+
+TEST_F(DynamicKeymapMirror, SettingTheSameKeycodeWritesNothing) {
+    uint16_t keycode = dynamic_keymap_get_keycode(2, 3, 4);
+    set_eeprom_keycode(2, 3, 5, 0xBEEF);
+
+    dynamic_keymap_set_keycode(2, 3, 4, keycode);
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(2, 3, 5), 0xBEEF);
+
+    set_eeprom_keycode(2, 3, 5, dynamic_keymap_get_keycode(2, 3, 5));
+}
+
+TEST_F(DynamicKeymapMirror, FlushWritesEverythingAtOnce) {
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        dynamic_keymap_set_keycode(layer, layer, layer, 0x0100 + layer);
+    }
+    dynamic_keymap_flush();
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        EXPECT_EQ(eeprom_keycode(layer, layer, layer), 0x0100 + layer) << "layer " << (int)layer;
+    }
+}
+
+TEST_F(DynamicKeymapMirror, SetBufferIsWrittenBack) {
+    uint8_t buffer[] = {0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C};
+    dynamic_keymap_set_buffer(((3 * MATRIX_ROWS + 1) * MATRIX_COLS + 5) * 2, sizeof(buffer), buffer);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 1, 6), 0x000B);
+
+    advance_time(DYNAMIC_KEYMAP_WRITE_BACK_DELAY);
+    dynamic_keymap_task();
+    EXPECT_EQ(eeprom_keycode(3, 1, 5), 0x000A);
+    EXPECT_EQ(eeprom_keycode(3, 1, 6), 0x000B);
+    EXPECT_EQ(eeprom_keycode(3, 1, 7), 0x000C);
+}
+
+TEST_F(DynamicKeymapMirror, ResetIsWrittenBeforeReturning) {
+    dynamic_keymap_reset();
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                ASSERT_EQ(eeprom_keycode(layer, row, column), 0x0100 * (layer + 1) + row * MATRIX_COLS + column);
+            }
+        }
+    }
+}
+
+TEST_F(DynamicKeymapMirror, GetBufferPastTheEndReturnsZeros) {
+    uint8_t buffer[8];
+    memset(buffer, 0xAA, sizeof(buffer));
+    dynamic_keymap_get_buffer(KEYMAP_SIZE, sizeof(buffer), buffer);
+    for (size_t i = 0; i < sizeof(buffer); i++) {
+        EXPECT_EQ(buffer[i], 0) << "byte " << i;
+    }
+
+    dynamic_keymap_set_keycode(3, MATRIX_ROWS - 1, MATRIX_COLS - 1, 0x0E0F);
+    memset(buffer, 0xAA, sizeof(buffer));
+    dynamic_keymap_get_buffer(KEYMAP_SIZE - 2, sizeof(buffer), buffer);
+    EXPECT_EQ(buffer[0], 0x0E);
+    EXPECT_EQ(buffer[1], 0x0F);
+    for (size_t i = 2; i < sizeof(buffer); i++) {
+        EXPECT_EQ(buffer[i], 0) << "byte " << i;
+    }
+}
@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The keymap in flash, which dynamic_keymap_reset() copies from
+uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
+    return 0x0100 * (layer_num + 1) + row * MATRIX_COLS + column;
+}
+
+uint16_t keycode_at_encodermap_location_raw(uint8_t layer_num, uint8_t encoder_idx, bool clockwise) {
+    return 0;
+}
+
+void send_string_with_delay(const char *string, uint8_t interval) {}
+
+void tap_code16(uint16_t code) {}
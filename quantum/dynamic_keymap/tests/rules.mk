@@ -0,0 +1,9 @@
+dynamic_keymap_mirror_DEFS := -DEEPROM_CUSTOM -DDYNAMIC_KEYMAP_RAM_MIRROR
+dynamic_keymap_mirror_CONFIG := $(QUANTUM_PATH)/dynamic_keymap/tests/config_mock.h
+
+dynamic_keymap_mirror_SRC := \
+	platforms/test/timer.c \
+	platforms/test/eeprom.c \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/mock.c \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/dynamic_keymap_mirror_tests.cpp \
+	$(QUANTUM_PATH)/dynamic_keymap.c
@@ -0,0 +1 @@
+TEST_LIST += dynamic_keymap_mirror
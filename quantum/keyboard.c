@@ -33,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "stage_probe.h"
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
 #endif
@@ -138,6 +139,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef PERF_TRACE_ENABLE
+#    include "perf_trace.h"
+#endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
+#ifdef KEYEVENT_QUEUE_ENABLE
+#    include "keyevent_queue.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -189,21 +199,34 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 // Only enable this if console is enabled to print to
 #if defined(DEBUG_MATRIX_SCAN_RATE)
-static uint32_t matrix_timer           = 0;
-static uint32_t matrix_scan_count      = 0;
-static uint32_t last_matrix_scan_count = 0;
+static uint32_t matrix_timer = 0;
+// Free-running and only written by the scanning side, which may be the keyevent queue's scan thread
+static volatile uint32_t matrix_scan_count          = 0;
+static uint32_t          matrix_scan_count_at_timer = 0;
+static uint32_t          last_matrix_scan_count     = 0;
+
+static inline void matrix_scan_perf_count(void) {
+    // Idle passes don't read the matrix, so only count real scans
+    if (!matrix_scan_idle()) {
+        matrix_scan_count++;
+    }
+}
 
 void matrix_scan_perf_task(void) {
-    matrix_scan_count++;
-
     uint32_t timer_now = timer_read32();
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
+        const uint32_t scan_count  = matrix_scan_count;
+        last_matrix_scan_count     = scan_count - matrix_scan_count_at_timer;
+        matrix_scan_count_at_timer = scan_count;
 #    if defined(CONSOLE_ENABLE)
-        dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+        dprintf("matrix scan frequency: %lu\n", last_matrix_scan_count);
+#        ifdef KEYEVENT_QUEUE_ENABLE
+        keyevent_queue_stats_t stats;
+        keyevent_queue_get_stats(&stats);
+        dprintf("keyevent queue depth: %u, max: %u, overflows: %lu\n", stats.depth, stats.max_depth, stats.overflows);
+#        endif
 #    endif
-        last_matrix_scan_count = matrix_scan_count;
-        matrix_timer           = timer_now;
-        matrix_scan_count      = 0;
+        matrix_timer = timer_now;
     }
 }
 
@@ -211,6 +234,7 @@ uint32_t get_matrix_scan_rate(void) {
     return last_matrix_scan_count;
 }
 #else
+#    define matrix_scan_perf_count()
 #    define matrix_scan_perf_task()
 #endif
 
@@ -308,6 +332,14 @@ __attribute__((weak)) bool matrix_can_read(void) {
     return true;
 }
 
+/** \brief matrix_scan_idle
+ *
+ * Whether the matrix is waiting for a wakeup instead of being scanned, see MATRIX_SCAN_ON_INTERRUPT.
+ */
+__attribute__((weak)) bool matrix_scan_idle(void) {
+    return false;
+}
+
 /** \brief keyboard_setup
  *
  * FIXME: needs doc
@@ -467,6 +499,10 @@ void keyboard_init(void) {
     debug_enable = true;
 #endif
 
+#ifdef KEYEVENT_QUEUE_ENABLE
+    keyevent_queue_start_scanning();
+#endif
+
     keyboard_post_init_kb(); /* Always keep this last */
 }
 
@@ -497,67 +533,186 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
 /**
- * @brief This task scans the keyboards matrix and processes any key presses
- * that occur.
+ * @brief Builds a key event stamped with the scan time of the key's edge.
  *
- * @return true Matrix did change
- * @return false Matrix didn't change
+ * Times are kept from going backwards, as a late edge from the other half
+ * must not appear to precede events that were already processed.
  */
-static bool matrix_task(void) {
-    if (!matrix_can_read()) {
-        generate_tick_event();
-        return false;
+static keyevent_t make_scanned_keyevent(uint8_t row, uint8_t col, bool pressed) {
+    static uint16_t last_time  = 0;
+    uint16_t        event_time = matrix_get_key_time(row, col);
+    uint16_t        now        = timer_read();
+
+    if (TIMER_DIFF_16(now, event_time) > TIMER_DIFF_16(now, last_time)) {
+        event_time = last_time;
     }
+    last_time = event_time;
+    return MAKE_KEYEVENT_AT(row, col, pressed, event_time);
+}
+#    define MAKE_SCANNED_KEYEVENT(row, col, pressed) make_scanned_keyevent((row), (col), (pressed))
+#else
+#    define MAKE_SCANNED_KEYEVENT(row, col, pressed) MAKE_KEYEVENT((row), (col), (pressed))
+#endif
 
+/**
+ * @brief Scans the matrix and reports every key that changed since the
+ * previous scan.
+ *
+ * @param key_changed Called for each change, returns false when the change
+ * could not be taken. Reporting then stops, and the next call reports the
+ * rest of the same scan before scanning again, so changes keep their order.
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static inline bool matrix_scan_changes(bool (*key_changed)(uint8_t row, uint8_t col, bool pressed)) {
     static matrix_row_t matrix_previous[MATRIX_ROWS];
+    // The rows reported on, kept while changes are still waiting to be taken
+    static matrix_row_t matrix_scanned[MATRIX_ROWS];
+    static bool         matrix_backlogged = false;
 
-    matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
+    if (!matrix_backlogged) {
+        if (!matrix_can_read()) {
+            return false;
+        }
+
+        STAGE_PROBE_BEGIN(STAGE_MATRIX_SCAN);
+        matrix_scan();
+        STAGE_PROBE_END(STAGE_MATRIX_SCAN);
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            matrix_scanned[row] = matrix_get_row(row);
+        }
+        matrix_scan_perf_count();
     }
 
-    matrix_scan_perf_task();
+    // Compare every row once, dispatching below only visits the rows flagged here
+    uint32_t changed_rows[(MATRIX_ROWS + 31) / 32] = {0};
+    bool     matrix_changed                        = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_previous[row] ^ matrix_scanned[row]) {
+            changed_rows[row / 32] |= (uint32_t)1 << (row % 32);
+            matrix_changed = true;
+        }
+    }
 
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
-        generate_tick_event();
         return matrix_changed;
     }
 
+#ifndef KEYEVENT_QUEUE_ENABLE
     if (debug_config.matrix) {
         matrix_print();
     }
+#endif
 
-    const bool process_keypress = should_process_keypress();
+    bool refused = false;
+    for (uint8_t word = 0; word < ARRAY_SIZE(changed_rows) && !refused; word++) {
+        for (uint32_t rows = changed_rows[word]; rows && !refused; rows &= rows - 1) {
+            const uint8_t      row         = word * 32 + __builtin_ctzl(rows);
+            const matrix_row_t current_row = matrix_scanned[row];
 
-    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-        const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+            if (has_ghost_in_row(row, current_row)) {
+                continue;
+            }
+
+            // Bits past MATRIX_COLS never produced events, keep it that way
+            matrix_row_t row_changes = (current_row ^ matrix_previous[row]) & (matrix_row_t)(((matrix_row_t)2 << (MATRIX_COLS - 1)) - 1);
+            for (; row_changes; row_changes &= row_changes - 1) {
+                const uint8_t col = __builtin_ctzl(row_changes);
+
+                if (!key_changed(row, col, current_row & ((matrix_row_t)1 << col))) {
+                    refused = true;
+                    break;
+                }
+            }
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
-            continue;
+            // Whatever was not taken stays a change for the next call
+            matrix_previous[row] = current_row ^ row_changes;
         }
+    }
+    matrix_backlogged = refused;
 
-        matrix_row_t col_mask = 1;
-        for (uint8_t col = 0; col < MATRIX_COLS; col++, col_mask <<= 1) {
-            if (row_changes & col_mask) {
-                const bool key_pressed = current_row & col_mask;
+    return matrix_changed;
+}
 
-                if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
-                }
+#ifdef KEYEVENT_QUEUE_ENABLE
+static bool queue_key_change(uint8_t row, uint8_t col, bool pressed) {
+    return keyevent_queue_push(MAKE_SCANNED_KEYEVENT(row, col, pressed));
+}
 
-                switch_events(row, col, key_pressed);
-            }
+bool keyevent_queue_scan(void) {
+    return matrix_scan_changes(queue_key_change);
+}
+
+/**
+ * @brief This task processes the key presses queued by the matrix scan,
+ * scanning first unless a scan thread does so.
+ *
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static bool matrix_task(void) {
+    if (keyevent_queue_is_threaded()) {
+        // The scan thread only scans and debounces, the hooks run here
+        matrix_scan_kb();
+    } else {
+        keyevent_queue_scan();
+    }
+    matrix_scan_perf_task();
+
+    const bool process_keypress = should_process_keypress();
+    bool       matrix_changed   = false;
+    keyevent_t event;
+
+    while (keyevent_queue_pop(&event)) {
+        matrix_changed = true;
+        if (process_keypress) {
+            STAGE_PROBE_BEGIN_ARG(STAGE_ACTION_EXEC, (uint16_t)event.key.row << 8 | event.key.col);
+            action_exec(event);
+            STAGE_PROBE_END_ARG(STAGE_ACTION_EXEC, (uint16_t)event.key.row << 8 | event.key.col);
         }
 
-        matrix_previous[row] = current_row;
+        switch_events(event.key.row, event.key.col, event.pressed);
+    }
+
+    if (!matrix_changed) {
+        generate_tick_event();
+    } else if (debug_config.matrix) {
+        matrix_print();
     }
+    return matrix_changed;
+}
+#else
+static bool process_key_change(uint8_t row, uint8_t col, bool pressed) {
+    if (should_process_keypress()) {
+        STAGE_PROBE_BEGIN_ARG(STAGE_ACTION_EXEC, (uint16_t)row << 8 | col);
+        action_exec(MAKE_SCANNED_KEYEVENT(row, col, pressed));
+        STAGE_PROBE_END_ARG(STAGE_ACTION_EXEC, (uint16_t)row << 8 | col);
+    }
+
+    switch_events(row, col, pressed);
+    return true;
+}
 
+/**
+ * @brief This task scans the keyboards matrix and processes any key presses
+ * that occur.
+ *
+ * @return true Matrix did change
+ * @return false Matrix didn't change
+ */
+static bool matrix_task(void) {
+    const bool matrix_changed = matrix_scan_changes(process_key_change);
+    matrix_scan_perf_task();
+    if (!matrix_changed) {
+        generate_tick_event();
+    }
     return matrix_changed;
 }
+#endif // KEYEVENT_QUEUE_ENABLE
 
 /** \brief Tasks previously located in matrix_scan_quantum
  *
@@ -726,5 +881,13 @@ void keyboard_task(void) {
     bluetooth_task();
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_task();
+#endif
+
+#ifdef PERF_TRACE_ENABLE
+    perf_trace_task();
+#endif
+
     led_task();
 }
@@ -76,6 +76,11 @@ static inline bool IS_ENCODEREVENT(const keyevent_t event) {
  */
 #define MAKE_KEYEVENT(row_num, col_num, press) MAKE_EVENT((row_num), (col_num), (press), KEY_EVENT)
 
+/**
+ * @brief Constructs a key event for a pressed or released key that happened at `event_time`.
+ */
+#define MAKE_KEYEVENT_AT(row_num, col_num, press, event_time) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = (event_time), .type = KEY_EVENT})
+
 /**
  * @brief Constructs a combo event.
  */
@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyevent_queue.h"
+
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+#    include <ch.h>
+#endif
+
+#ifndef KEYEVENT_QUEUE_SCAN_INTERVAL_US
+#    define KEYEVENT_QUEUE_SCAN_INTERVAL_US 1000
+#endif
+
+#ifndef KEYEVENT_QUEUE_SCAN_THREAD_STACK_SIZE
+#    define KEYEVENT_QUEUE_SCAN_THREAD_STACK_SIZE 512
+#endif
+
+#ifndef KEYEVENT_QUEUE_SCAN_THREAD_PRIORITY
+#    define KEYEVENT_QUEUE_SCAN_THREAD_PRIORITY (NORMALPRIO + 1)
+#endif
+
+#define KEYEVENT_QUEUE_INDEX_MASK (KEYEVENT_QUEUE_SIZE - 1)
+
+static keyevent_t keyevent_queue[KEYEVENT_QUEUE_SIZE];
+// Free-running write counter, only written by the producer.
+static uint8_t keyevent_queue_head = 0;
+// Free-running read counter, only written by the consumer.
+static uint8_t keyevent_queue_tail = 0;
+// Only written by the producer, cleared by the consumer.
+static uint8_t  keyevent_queue_max_depth = 0;
+static uint32_t keyevent_queue_overflows = 0;
+
+bool keyevent_queue_push(keyevent_t event) {
+    uint8_t head  = keyevent_queue_head;
+    uint8_t depth = head - __atomic_load_n(&keyevent_queue_tail, __ATOMIC_ACQUIRE);
+    if (depth >= KEYEVENT_QUEUE_SIZE) {
+        keyevent_queue_overflows++;
+        return false;
+    }
+
+    keyevent_queue[head & KEYEVENT_QUEUE_INDEX_MASK] = event;
+    // Publish the record before the consumer can see the new head
+    __atomic_store_n(&keyevent_queue_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+
+    if (depth + 1 > keyevent_queue_max_depth) {
+        keyevent_queue_max_depth = depth + 1;
+    }
+    return true;
+}
+
+bool keyevent_queue_pop(keyevent_t *event) {
+    uint8_t tail = keyevent_queue_tail;
+    if (tail == __atomic_load_n(&keyevent_queue_head, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    *event = keyevent_queue[tail & KEYEVENT_QUEUE_INDEX_MASK];
+    // Hand the slot back only once the record has been copied out
+    __atomic_store_n(&keyevent_queue_tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+void keyevent_queue_flush(void) {
+    __atomic_store_n(&keyevent_queue_tail, __atomic_load_n(&keyevent_queue_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+uint8_t keyevent_queue_depth(void) {
+    return (uint8_t)(__atomic_load_n(&keyevent_queue_head, __ATOMIC_ACQUIRE) - __atomic_load_n(&keyevent_queue_tail, __ATOMIC_ACQUIRE));
+}
+
+void keyevent_queue_get_stats(keyevent_queue_stats_t *stats) {
+    stats->depth     = keyevent_queue_depth();
+    stats->max_depth = keyevent_queue_max_depth;
+    stats->overflows = keyevent_queue_overflows;
+}
+
+void keyevent_queue_clear_stats(void) {
+    // Racing a concurrent push can at worst keep one stale sample
+    keyevent_queue_max_depth = 0;
+    keyevent_queue_overflows = 0;
+}
+
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+// Held by the thread while it scans, and by the main loop while scanning is paused
+static BSEMAPHORE_DECL(keyevent_scan_permit, false);
+static bool keyevent_scan_paused = false;
+
+static THD_WORKING_AREA(waKeyeventScanThread, KEYEVENT_QUEUE_SCAN_THREAD_STACK_SIZE);
+static THD_FUNCTION(KeyeventScanThread, arg) {
+    (void)arg;
+    chRegSetThreadName("matrix_scan");
+
+    systime_t previous = chVTGetSystemTime();
+    while (true) {
+        if (chBSemWaitTimeout(&keyevent_scan_permit, TIME_IMMEDIATE) != MSG_OK) {
+            chBSemWait(&keyevent_scan_permit);
+            // Don't make up for the scans missed while paused
+            previous = chVTGetSystemTime();
+        }
+        keyevent_queue_scan();
+        chBSemSignal(&keyevent_scan_permit);
+        previous = chThdSleepUntilWindowed(previous, chTimeAddX(previous, TIME_US2I(KEYEVENT_QUEUE_SCAN_INTERVAL_US)));
+    }
+}
+#endif // KEYEVENT_QUEUE_SCAN_THREAD
+
+void keyevent_queue_start_scanning(void) {
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+    chThdCreateStatic(waKeyeventScanThread, sizeof(waKeyeventScanThread), KEYEVENT_QUEUE_SCAN_THREAD_PRIORITY, KeyeventScanThread, NULL);
+#endif // KEYEVENT_QUEUE_SCAN_THREAD
+}
+
+void keyevent_queue_pause_scanning(void) {
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+    if (!keyevent_scan_paused) {
+        // Waits for a scan in progress to finish
+        chBSemWait(&keyevent_scan_permit);
+        keyevent_scan_paused = true;
+    }
+#endif // KEYEVENT_QUEUE_SCAN_THREAD
+}
+
+void keyevent_queue_resume_scanning(void) {
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+    if (keyevent_scan_paused) {
+        keyevent_scan_paused = false;
+        chBSemSignal(&keyevent_scan_permit);
+    }
+#endif // KEYEVENT_QUEUE_SCAN_THREAD
+}
+
+bool keyevent_queue_is_threaded(void) {
+#ifdef KEYEVENT_QUEUE_SCAN_THREAD
+    return true;
+#else
+    return false;
+#endif // KEYEVENT_QUEUE_SCAN_THREAD
+}
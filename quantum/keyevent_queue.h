@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Single producer, single consumer queue of key events.
+
+    With KEYEVENT_QUEUE_ENABLE the matrix is scanned and debounced by a
+    producer that pushes one keyevent_t per changed key, and keyboard_task()
+    drains the queue into action_exec(). On ChibiOS (non-split) the producer is
+    a dedicated thread scanning at a fixed interval, so a slow rendering task
+    in the main loop no longer delays or jitters matrix scanning. Elsewhere the
+    producer runs inline at the start of keyboard_task().
+
+    The producer thread only scans and debounces, matrix_scan_kb() and the
+    debug output stay on the main loop.
+
+    Neither side takes a lock: the producer only writes the head, the consumer
+    only writes the tail. A push into a full queue fails and is counted, the
+    producer then stops and delivers the rest of that scan once the queue has
+    room, before scanning again, so events keep their order and no edge is lost.
+
+    While suspended the scan thread is paused, so suspend_wakeup_condition()
+    can scan the matrix on its own, and the queue is flushed on suspend and
+    on wakeup so no stale events are replayed afterwards.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+// The scan thread would race the main loop for the split link, so split keyboards scan inline
+#if defined(PROTOCOL_CHIBIOS) && !defined(SPLIT_KEYBOARD) && !defined(KEYEVENT_QUEUE_NO_THREAD)
+#    define KEYEVENT_QUEUE_SCAN_THREAD
+#endif
+
+#ifndef KEYEVENT_QUEUE_SIZE
+#    define KEYEVENT_QUEUE_SIZE 32
+#endif
+
+_Static_assert((KEYEVENT_QUEUE_SIZE & (KEYEVENT_QUEUE_SIZE - 1)) == 0 && KEYEVENT_QUEUE_SIZE <= 128, "KEYEVENT_QUEUE_SIZE must be a power of two, at most 128");
+
+typedef struct {
+    uint8_t  depth;     // events currently queued
+    uint8_t  max_depth; // highest depth seen since the last clear
+    uint32_t overflows; // pushes refused because the queue was full
+} keyevent_queue_stats_t;
+
+/** \brief Queues an event, returns false if the queue is full. Producer only. */
+bool keyevent_queue_push(keyevent_t event);
+
+/** \brief Takes the oldest event, returns false if the queue is empty. Consumer only. */
+bool keyevent_queue_pop(keyevent_t *event);
+
+/** \brief Drops every queued event. Consumer only. */
+void keyevent_queue_flush(void);
+
+uint8_t keyevent_queue_depth(void);
+
+void keyevent_queue_get_stats(keyevent_queue_stats_t *stats);
+void keyevent_queue_clear_stats(void);
+
+/** \brief Starts the scan thread where the platform has one, see keyboard_init(). */
+void keyevent_queue_start_scanning(void);
+
+/** \brief Stops the scan thread once its current scan is done, until resumed. Main loop only. */
+void keyevent_queue_pause_scanning(void);
+void keyevent_queue_resume_scanning(void);
+
+/** \brief True when a scan thread feeds the queue, rather than keyboard_task(). */
+bool keyevent_queue_is_threaded(void);
+
+/** \brief Scans the matrix once and queues its changes, implemented in keyboard.c. */
+bool keyevent_queue_scan(void);
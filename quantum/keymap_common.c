@@ -37,15 +37,33 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "process_midi.h"
 #endif
 
+#ifdef ACTION_CACHE_ENABLE
+#    include "action_cache.h"
+#endif
+
 extern keymap_config_t keymap_config;
 
 #include <inttypes.h>
 
 /* converts key to action */
 action_t action_for_key(uint8_t layer, keypos_t key) {
+#ifdef ACTION_CACHE_ENABLE
+    action_t action;
+    if (action_cache_get(layer, key, &action)) {
+        return action;
+    }
+#endif
+
     // 16bit keycodes - important
     uint16_t keycode = keymap_key_to_keycode(layer, key);
+
+#ifdef ACTION_CACHE_ENABLE
+    action = action_for_keycode(keycode);
+    action_cache_set(layer, key, action);
+    return action;
+#else
     return action_for_keycode(keycode);
+#endif
 };
 
 action_t action_for_keycode(uint16_t keycode) {
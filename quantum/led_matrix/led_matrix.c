@@ -31,6 +31,14 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef LED_MATRIX_ASYNC_FLUSH
+// The queue only carries the writes of the I2C drivers in led_matrix_drivers.c
+#    if !defined(PROTOCOL_CHIBIOS) || !(defined(IS31FL3731) || defined(IS31FL3733) || defined(IS31FLCOMMON) || defined(CKLED2001))
+#        error "LED_MATRIX_ASYNC_FLUSH requires ChibiOS and an I2C LED driver"
+#    endif
+#    include "i2c_master.h"
+#endif // LED_MATRIX_ASYNC_FLUSH
+
 #ifndef LED_MATRIX_CENTER
 const led_point_t k_led_matrix_center = {112, 32};
 #else
@@ -93,6 +101,13 @@ uint32_t       g_led_timer;
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // LED_MATRIX_FRAMEBUFFER_EFFECTS
+#ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+#    ifndef LED_MATRIX_SPLIT
+#        error "LED_MATRIX_SPLIT_FRAMEBUFFER requires LED_MATRIX_SPLIT"
+#    endif
+// Every LED value set on the master, the slave half of it is mirrored to the slave
+uint8_t g_led_split_framebuffer[LED_MATRIX_LED_COUNT];
+#endif // LED_MATRIX_SPLIT_FRAMEBUFFER
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
@@ -158,13 +173,38 @@ uint8_t led_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void led_matrix_update_pwm_buffers(void) {
+#ifdef LED_MATRIX_ASYNC_FLUSH
+    // Queue the writes and return while they are sent
+    i2c_queue_begin();
+    if (i2c_queue_failed()) {
+        // Some of the previous frame never made it, so send everything again
+        led_matrix_driver_invalidate();
+    }
     led_matrix_driver.flush();
+    i2c_queue_end();
+#else
+    led_matrix_driver.flush();
+#endif // LED_MATRIX_ASYNC_FLUSH
+}
+
+// Whether the previous flush is still being sent to the drivers
+static inline bool led_matrix_flush_busy(void) {
+#ifdef LED_MATRIX_ASYNC_FLUSH
+    return i2c_queue_busy();
+#else
+    return false;
+#endif // LED_MATRIX_ASYNC_FLUSH
 }
 
 void led_matrix_set_value(int index, uint8_t value) {
 #ifdef USE_CIE1931_CURVE
     value = pgm_read_byte(&CIE1931_CURVE[value]);
 #endif
+#ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+    if (index >= 0 && index < LED_MATRIX_LED_COUNT) {
+        g_led_split_framebuffer[index] = value;
+    }
+#endif // LED_MATRIX_SPLIT_FRAMEBUFFER
     led_matrix_driver.set_value(index, value);
 }
 
@@ -352,6 +392,16 @@ static void led_task_flush(uint8_t effect) {
 }
 
 void led_matrix_task(void) {
+#ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+    // The slave shows what the master renders, its LEDs are set by the split transport
+    if (!is_keyboard_master()) {
+        if (!led_matrix_flush_busy()) {
+            led_matrix_update_pwm_buffers();
+        }
+        return;
+    }
+#endif // LED_MATRIX_SPLIT_FRAMEBUFFER
+
     led_task_timers();
 
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
@@ -379,6 +429,10 @@ void led_matrix_task(void) {
             }
             break;
         case FLUSHING:
+            // Keep scanning until the previous frame has been sent
+            if (led_matrix_flush_busy()) {
+                break;
+            }
             led_task_flush(effect);
             break;
         case SYNCING:
@@ -47,7 +47,7 @@
 #define LED_MATRIX_LED_PROCESS_MAX_ITERATIONS ((LED_MATRIX_LED_COUNT + LED_MATRIX_LED_PROCESS_LIMIT - 1) / LED_MATRIX_LED_PROCESS_LIMIT)
 
 #if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT
-#    if defined(LED_MATRIX_SPLIT)
+#    if defined(LED_MATRIX_SPLIT) && !defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
 #        define LED_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t min = LED_MATRIX_LED_PROCESS_LIMIT * params->iter;                            \
             uint8_t max = min + LED_MATRIX_LED_PROCESS_LIMIT;                                     \
@@ -62,7 +62,7 @@
             if (max > LED_MATRIX_LED_COUNT) max = LED_MATRIX_LED_COUNT;
 #    endif
 #else
-#    if defined(LED_MATRIX_SPLIT)
+#    if defined(LED_MATRIX_SPLIT) && !defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
 #        define LED_MATRIX_USE_LIMITS(min, max)                                                   \
             uint8_t       min                   = 0;                                              \
             uint8_t       max                   = LED_MATRIX_LED_COUNT;                           \
@@ -177,7 +177,7 @@ typedef struct {
 } led_matrix_driver_t;
 
 static inline bool led_matrix_check_finished_leds(uint8_t led_idx) {
-#if defined(LED_MATRIX_SPLIT)
+#if defined(LED_MATRIX_SPLIT) && !defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
     if (is_keyboard_left()) {
         uint8_t k_led_matrix_split[2] = LED_MATRIX_SPLIT;
         return led_idx < k_led_matrix_split[0];
@@ -189,6 +189,10 @@ static inline bool led_matrix_check_finished_leds(uint8_t led_idx) {
 }
 
 extern const led_matrix_driver_t led_matrix_driver;
+#ifdef LED_MATRIX_ASYNC_FLUSH
+// Makes the next flush rewrite every PWM register of the drivers
+void led_matrix_driver_invalidate(void);
+#endif
 
 extern led_eeconfig_t led_matrix_eeconfig;
 
@@ -200,3 +204,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef LED_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_led_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+extern uint8_t g_led_split_framebuffer[LED_MATRIX_LED_COUNT];
+#endif
@@ -244,4 +244,18 @@ const led_matrix_driver_t led_matrix_driver = {
     .set_value_all = ckled2001_set_value_all,
 };
 #    endif
+
+#    ifdef LED_MATRIX_ASYNC_FLUSH
+void led_matrix_driver_invalidate(void) {
+#        if defined(IS31FL3731)
+    is31fl3731_invalidate_pwm_buffers();
+#        elif defined(IS31FL3733)
+    is31fl3733_invalidate_pwm_buffers();
+#        elif defined(IS31FLCOMMON)
+    IS31FL_common_invalidate_pwm_register();
+#        elif defined(CKLED2001)
+    ckled2001_invalidate_pwm_buffers();
+#        endif
+}
+#    endif // LED_MATRIX_ASYNC_FLUSH
 #endif
@@ -21,6 +21,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#include "timer.h"
+#ifdef KEYEVENT_QUEUE_ENABLE
+#    include "keyevent_queue.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -75,6 +79,7 @@ extern uint8_t thisHand, thatHand;
 __attribute__((weak)) void matrix_init_pins(void);
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row);
 __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[], uint8_t current_col, matrix_row_t row_shifter);
+__attribute__((weak)) void matrix_wakeup_enable_pin(pin_t pin, bool enable);
 
 static inline void setPinOutput_writeLow(pin_t pin) {
     ATOMIC_BLOCK_FORCEON {
@@ -172,6 +177,79 @@ __attribute__((weak)) void matrix_init_pins(void) {
     }
 }
 
+#            if defined(readPort) && !defined(MATRIX_DISABLE_PORT_READS)
+#                define MATRIX_PORT_READS
+
+/* Col pins on one port whose column index is their port bit plus `shift`. */
+typedef struct {
+    port_data_t mask;
+    uint8_t     port;
+    int8_t      shift; // column index minus port bit
+} matrix_col_run_t;
+
+static pin_t            col_port_pins[MATRIX_COLS]; // one pin per port, used to read that port
+static uint8_t          col_port_count;
+static matrix_col_run_t col_runs[MATRIX_COLS];
+static uint8_t          col_run_count;
+
+/**
+ * \brief Groups col_pins by GPIO port so each row costs one register read per port.
+ *
+ * Called from matrix_init() once the pins for this hand are known.
+ */
+static void matrix_init_col_runs(void) {
+    col_port_count = 0;
+    col_run_count  = 0;
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin = col_pins[col];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        uint8_t port = 0;
+        while (port < col_port_count && getPinPort(col_port_pins[port]) != getPinPort(pin)) {
+            port++;
+        }
+        if (port == col_port_count) {
+            col_port_pins[col_port_count++] = pin;
+        }
+
+        // Pins sharing a port and an offset are extracted together, wherever they sit in the row
+        int8_t            shift = (int8_t)col - (int8_t)getPinPortBit(pin);
+        matrix_col_run_t *run   = col_runs;
+        while (run < &col_runs[col_run_count] && (run->port != port || run->shift != shift)) {
+            run++;
+        }
+        if (run == &col_runs[col_run_count]) {
+            col_run_count++;
+            run->mask  = 0;
+            run->port  = port;
+            run->shift = shift;
+        }
+        run->mask |= (port_data_t)1 << getPinPortBit(pin);
+    }
+}
+
+static inline matrix_row_t matrix_read_col_ports(void) {
+    port_data_t port_state[MATRIX_COLS];
+    for (uint8_t port = 0; port < col_port_count; port++) {
+        port_state[port] = readPort(col_port_pins[port]);
+#                if MATRIX_INPUT_PRESSED_STATE == 0
+        port_state[port] = ~port_state[port];
+#                endif
+    }
+
+    matrix_row_t row_value = 0;
+    for (uint8_t i = 0; i < col_run_count; i++) {
+        const matrix_col_run_t *run  = &col_runs[i];
+        uint32_t                bits = port_state[run->port] & run->mask;
+        row_value |= (matrix_row_t)(run->shift >= 0 ? bits << run->shift : bits >> -run->shift);
+    }
+    return row_value;
+}
+#            endif
+
 __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[], uint8_t current_row) {
     // Start with a clear matrix row
     matrix_row_t current_row_value = 0;
@@ -181,6 +259,10 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_PORT_READS
+    // Read each port once and map its bits onto the columns
+    current_row_value = matrix_read_col_ports();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +271,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
@@ -270,6 +353,185 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+#    if !defined(DIRECT_PINS) && !(defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS))
+#        error MATRIX_SCAN_ON_INTERRUPT requires DIRECT_PINS or MATRIX_ROW_PINS and MATRIX_COL_PINS
+#    endif
+
+#    ifndef MATRIX_SCAN_GRACE_PERIOD
+#        define MATRIX_SCAN_GRACE_PERIOD 50
+#    endif
+
+// Lines that see a key press while every output is selected
+#    if defined(DIRECT_PINS)
+#        define MATRIX_IDLE_INPUT_COUNT (ROWS_PER_HAND * MATRIX_COLS)
+#        define MATRIX_IDLE_INPUT_PIN(i) (direct_pins[(i) / MATRIX_COLS][(i) % MATRIX_COLS])
+#    elif (DIODE_DIRECTION == COL2ROW)
+#        define MATRIX_IDLE_INPUT_COUNT (MATRIX_COLS)
+#        define MATRIX_IDLE_INPUT_PIN(i) (col_pins[i])
+#    else
+#        define MATRIX_IDLE_INPUT_COUNT (ROWS_PER_HAND)
+#        define MATRIX_IDLE_INPUT_PIN(i) (row_pins[i])
+#    endif
+
+#    if defined(PROTOCOL_CHIBIOS) && (PAL_USE_CALLBACKS == TRUE)
+#        define MATRIX_WAKEUP_INTERRUPTS
+
+static void matrix_wakeup_callback(void *arg) {
+    (void)arg;
+    matrix_wakeup_signal();
+}
+
+__attribute__((weak)) void matrix_wakeup_enable_pin(pin_t pin, bool enable) {
+    if (enable) {
+        palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(pin, matrix_wakeup_callback, NULL);
+    } else {
+        palDisableLineEvent(pin);
+    }
+}
+#    else
+__attribute__((weak)) void matrix_wakeup_enable_pin(pin_t pin, bool enable) {}
+#    endif
+
+static bool          matrix_idle = false;
+static volatile bool matrix_wakeup_pending;
+static uint32_t      matrix_last_activity;
+// Set when the input pins cannot all raise an event of their own, they are read every pass instead
+static bool matrix_wakeup_polled = true;
+
+void matrix_wakeup_signal(void) {
+    matrix_wakeup_pending = true;
+}
+
+bool matrix_scan_idle(void) {
+#    ifdef MATRIX_WAKEUP_INTERRUPTS
+    // Keyboards sleep while idle, so only report it when an interrupt is sure to end it
+    return matrix_idle && !matrix_wakeup_polled;
+#    else
+    return matrix_idle;
+#    endif
+}
+
+/**
+ * \brief Checks whether every input pin can get a wakeup event of its own.
+ *
+ * STM32 EXTI lines are shared by the pins with the same number on all ports,
+ * e.g. A1 and B1, and only one of them can raise events.
+ */
+static bool matrix_wakeup_lines_available(void) {
+#    if defined(MATRIX_WAKEUP_INTERRUPTS)
+#        if defined(MCU_STM32)
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        pin_t pin = MATRIX_IDLE_INPUT_PIN(i);
+        for (uint8_t j = 0; pin != NO_PIN && j < i; j++) {
+            pin_t other = MATRIX_IDLE_INPUT_PIN(j);
+            if (other != NO_PIN && other != pin && PAL_PAD(other) == PAL_PAD(pin)) {
+                return false;
+            }
+        }
+    }
+#        endif
+    return true;
+#    else
+    return false;
+#    endif
+}
+
+static void matrix_idle_init(void) {
+    matrix_wakeup_polled = !matrix_wakeup_lines_available();
+}
+
+static void matrix_idle_select_all(bool select) {
+#    if defined(DIRECT_PINS)
+    (void)select;
+#    elif (DIODE_DIRECTION == COL2ROW)
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        select ? (void)select_row(x) : unselect_row(x);
+    }
+#    else
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        select ? (void)select_col(x) : unselect_col(x);
+    }
+#    endif
+}
+
+static void matrix_idle_arm(bool enable) {
+    if (matrix_wakeup_polled) {
+        return;
+    }
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        pin_t pin = MATRIX_IDLE_INPUT_PIN(i);
+        if (pin != NO_PIN) {
+            matrix_wakeup_enable_pin(pin, enable);
+        }
+    }
+}
+
+static bool matrix_idle_any_pressed(void) {
+    for (uint8_t i = 0; i < MATRIX_IDLE_INPUT_COUNT; i++) {
+        if (readMatrixPin(MATRIX_IDLE_INPUT_PIN(i)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void matrix_idle_exit(void) {
+    matrix_idle_arm(false);
+    matrix_idle_select_all(false);
+    matrix_output_unselect_delay(0, true);
+    matrix_idle          = false;
+    matrix_last_activity = timer_read32();
+}
+
+/**
+ * \brief Leaves the idle state when a wakeup is due.
+ *
+ * With wakeup interrupts this only checks the flag set by the ISR, otherwise
+ * a single read of the input lines (all outputs still selected) stands in for
+ * the full scan.
+ *
+ * \return true if a full scan should run.
+ */
+static bool matrix_idle_wake(void) {
+    if (!matrix_wakeup_pending && !(matrix_wakeup_polled && matrix_idle_any_pressed())) {
+        return false;
+    }
+    matrix_idle_exit();
+    return true;
+}
+
+/**
+ * \brief Enters the idle state once this hand has been released for MATRIX_SCAN_GRACE_PERIOD.
+ *
+ * Waiting for the debounced matrix as well keeps releases from being cut short.
+ */
+static void matrix_idle_update(matrix_row_t debounced[]) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] | debounced[row]) {
+            matrix_last_activity = timer_read32();
+            return;
+        }
+    }
+
+    if (timer_elapsed32(matrix_last_activity) < MATRIX_SCAN_GRACE_PERIOD) {
+        return;
+    }
+
+    matrix_wakeup_pending = false;
+    matrix_idle_select_all(true);
+    matrix_output_select_delay();
+    matrix_idle_arm(true);
+    matrix_idle = true;
+
+    // A key pressed before the interrupts were armed raised no edge
+    if (matrix_idle_any_pressed()) {
+        matrix_idle_exit();
+    }
+}
+#endif // MATRIX_SCAN_ON_INTERRUPT
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -300,6 +562,10 @@ void matrix_init(void) {
     thatHand = ROWS_PER_HAND - thisHand;
 #endif
 
+#ifdef MATRIX_PORT_READS
+    matrix_init_col_runs();
+#endif
+
     // initialize key pins
     matrix_init_pins();
 
@@ -309,6 +575,10 @@ void matrix_init(void) {
 
     debounce_init(ROWS_PER_HAND);
 
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+    matrix_idle_init();
+#endif
+
     matrix_init_kb();
 }
 
@@ -321,6 +591,19 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 #endif
 
 uint8_t matrix_scan(void) {
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+    if (matrix_idle && !matrix_idle_wake()) {
+#    ifdef SPLIT_KEYBOARD
+        return (uint8_t)matrix_post_scan();
+#    else
+#        ifndef KEYEVENT_QUEUE_SCAN_THREAD
+        matrix_scan_kb();
+#        endif
+        return 0;
+#    endif
+    }
+#endif
+
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
@@ -337,13 +620,27 @@ uint8_t matrix_scan(void) {
 #endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    if (changed) matrix_key_time_update(raw_matrix, curr_matrix);
+#endif
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifndef KEYEVENT_QUEUE_SCAN_THREAD
+    // Otherwise keyboard_task() runs it on the main loop
     matrix_scan_kb();
+#    endif
+#endif
+
+#ifdef MATRIX_SCAN_ON_INTERRUPT
+#    ifdef SPLIT_KEYBOARD
+    matrix_idle_update(matrix + thisHand);
+#    else
+    matrix_idle_update(matrix);
+#    endif
 #endif
     return (uint8_t)changed;
 }
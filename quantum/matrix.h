@@ -65,6 +65,15 @@ void matrix_output_unselect_delay(uint8_t line, bool key_pressed);
 /* only for backwards compatibility. delay between changing matrix pin state and reading values */
 void matrix_io_delay(void);
 
+/* scan time (sync_timer_read()) of the raw edge behind a key's current debounced state, see MATRIX_SCAN_TIMESTAMPS */
+uint16_t matrix_get_key_time(uint8_t row, uint8_t col);
+/* record edge times for this hand, call before the raw matrix is overwritten by a new scan */
+void matrix_key_time_update(const matrix_row_t previous_raw[], const matrix_row_t current_raw[]);
+/* whether matrix_scan() is idle, waiting on a wakeup instead of reading the pins */
+bool matrix_scan_idle(void);
+/* wake an idle matrix_scan() from a custom interrupt handler */
+void matrix_wakeup_signal(void);
+
 /* power control */
 void matrix_power_up(void);
 void matrix_power_down(void);
@@ -1,13 +1,17 @@
+#include <string.h>
 #include "matrix.h"
 #include "debounce.h"
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#include "sync_timer.h"
+#ifdef KEYEVENT_QUEUE_ENABLE
+#    include "keyevent_queue.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
-#    include <string.h>
 
 #    define ROWS_PER_HAND (MATRIX_ROWS / 2)
 #else
@@ -31,6 +35,11 @@ uint8_t thisHand, thatHand;
 extern const matrix_row_t matrix_mask[];
 #endif
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+// edge times, the other hand's rows are filled in by the split transport
+uint16_t matrix_key_time[MATRIX_ROWS][MATRIX_COLS];
+#endif
+
 // user-defined overridable functions
 
 __attribute__((weak)) void matrix_init_kb(void) {
@@ -69,6 +78,31 @@ inline matrix_row_t matrix_get_row(uint8_t row) {
 #endif
 }
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+uint16_t matrix_get_key_time(uint8_t row, uint8_t col) {
+    return matrix_key_time[row][col];
+}
+
+void matrix_key_time_update(const matrix_row_t previous_raw[], const matrix_row_t current_raw[]) {
+#    ifdef SPLIT_KEYBOARD
+    const matrix_row_t *cooked = matrix + thisHand;
+    uint16_t(*key_time)[MATRIX_COLS] = matrix_key_time + thisHand;
+#    else
+    const matrix_row_t *cooked = matrix;
+    uint16_t(*key_time)[MATRIX_COLS] = matrix_key_time;
+#    endif
+    uint16_t now = sync_timer_read();
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        // Only the first edge away from the debounced state counts, later bounces don't move it
+        matrix_row_t edges = (previous_raw[row] ^ current_raw[row]) & (current_raw[row] ^ cooked[row]);
+        for (; edges; edges &= edges - 1) {
+            key_time[row][__builtin_ctzl(edges)] = now;
+        }
+    }
+}
+#endif
+
 #if (MATRIX_COLS <= 8)
 #    define print_matrix_header() print("\nr/c 01234567\n")
 #    define print_matrix_row(row) print_bin_reverse8(matrix_get_row(row))
@@ -166,13 +200,27 @@ __attribute__((weak)) void matrix_init(void) {
 }
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    matrix_row_t previous_raw[ROWS_PER_HAND];
+    memcpy(previous_raw, raw_matrix, sizeof(previous_raw));
+#endif
+
     bool changed = matrix_scan_custom(raw_matrix);
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    if (changed) {
+        matrix_key_time_update(previous_raw, raw_matrix);
+    }
+#endif
+
 #ifdef SPLIT_KEYBOARD
     changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifndef KEYEVENT_QUEUE_SCAN_THREAD
+    // Otherwise keyboard_task() runs it on the main loop
     matrix_scan_kb();
+#    endif
 #endif
 
     return changed;
@@ -0,0 +1,189 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "perf_trace.h"
+#include "atomic_util.h"
+#include "timer.h"
+#include "print.h"
+
+#if !defined(PERF_TRACE_TIMESTAMP) && defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    if defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+#        define PERF_TRACE_TIMESTAMP() ((uint32_t)chSysGetRealtimeCounterX())
+#    endif
+#endif
+#ifndef PERF_TRACE_TIMESTAMP
+#    define PERF_TRACE_TIMESTAMP() timer_read32()
+#endif
+
+#ifdef PERF_TRACE_CONSOLE
+#    ifndef CONSOLE_ENABLE
+#        error "PERF_TRACE_CONSOLE requires CONSOLE_ENABLE = yes"
+#    endif
+#    ifndef PERF_TRACE_DRAIN_RECORDS
+#        define PERF_TRACE_DRAIN_RECORDS 4
+#    endif
+#    ifndef PERF_TRACE_DRAIN_INTERVAL
+#        define PERF_TRACE_DRAIN_INTERVAL 100
+#    endif
+#endif // PERF_TRACE_CONSOLE
+
+#define PERF_TRACE_INDEX_MASK (PERF_TRACE_BUFFER_SIZE - 1)
+
+// The sequence number publishes a record, it has to differ from the one of the previous lap
+_Static_assert(PERF_TRACE_BUFFER_SIZE <= 128, "PERF_TRACE_BUFFER_SIZE must be at most 128");
+
+static perf_trace_record_t perf_trace_buffer[PERF_TRACE_BUFFER_SIZE];
+// Free-running write counter, only ever incremented by writers.
+static uint16_t perf_trace_head = 0;
+// Free-running read counter, only touched by the reader.
+static uint16_t perf_trace_tail    = 0;
+static bool     perf_trace_enabled = true;
+
+static inline uint16_t claim_slot(void) {
+#if defined(__GCC_ATOMIC_SHORT_LOCK_FREE) && __GCC_ATOMIC_SHORT_LOCK_FREE == 2
+    return __atomic_fetch_add(&perf_trace_head, 1, __ATOMIC_RELAXED);
+#else
+    uint16_t slot;
+    ATOMIC_BLOCK_FORCEON {
+        slot = perf_trace_head++;
+    }
+    return slot;
+#endif
+}
+
+static inline uint16_t load_head(void) {
+    return __atomic_load_n(&perf_trace_head, __ATOMIC_ACQUIRE);
+}
+
+static inline void perf_trace_write(uint8_t event, uint16_t arg) {
+    if (!perf_trace_enabled) {
+        return;
+    }
+
+    uint16_t             slot   = claim_slot();
+    perf_trace_record_t *record = &perf_trace_buffer[slot & PERF_TRACE_INDEX_MASK];
+    record->timestamp           = PERF_TRACE_TIMESTAMP();
+    record->arg                 = arg;
+    record->event               = event;
+    // Written last, the reader takes the record once it carries the sequence number of its slot
+    __atomic_store_n(&record->sequence, (uint8_t)slot, __ATOMIC_RELEASE);
+}
+
+void stage_probe_begin(stage_probe_t stage, uint16_t arg) {
+    perf_trace_write(PERF_TRACE_EVENT_BEGIN(stage), arg);
+}
+
+void stage_probe_end(stage_probe_t stage, uint16_t arg) {
+    perf_trace_write(PERF_TRACE_EVENT_END(stage), arg);
+}
+
+void perf_trace_event(uint8_t event, uint16_t arg) {
+    perf_trace_write(event, arg);
+}
+
+void perf_trace_set_enabled(bool enabled) {
+    perf_trace_enabled = enabled;
+}
+
+bool perf_trace_is_enabled(void) {
+    return perf_trace_enabled;
+}
+
+void perf_trace_clear(void) {
+    perf_trace_tail = load_head();
+}
+
+uint8_t perf_trace_read(perf_trace_record_t *records, uint8_t max_count, uint16_t *dropped) {
+    uint8_t count = 0;
+    while (count < max_count) {
+        uint16_t available = load_head() - perf_trace_tail;
+        if (available > PERF_TRACE_BUFFER_SIZE) {
+            // Writers lapped the reader, skip to the oldest record still intact.
+            if (dropped) {
+                *dropped += available - PERF_TRACE_BUFFER_SIZE;
+            }
+            perf_trace_tail += available - PERF_TRACE_BUFFER_SIZE;
+            available = PERF_TRACE_BUFFER_SIZE;
+        }
+        if (available == 0) {
+            break;
+        }
+
+        // A claimed record that is still being written ends the read, it is taken next time.
+        perf_trace_record_t *record = &perf_trace_buffer[perf_trace_tail & PERF_TRACE_INDEX_MASK];
+        if (__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) != (uint8_t)perf_trace_tail) {
+            break;
+        }
+        records[count] = *record;
+
+        // A writer that lapped the reader while copying may have torn it, it is counted as dropped above.
+        if ((uint16_t)(load_head() - perf_trace_tail) > PERF_TRACE_BUFFER_SIZE) {
+            continue;
+        }
+        perf_trace_tail++;
+        count++;
+    }
+    return count;
+}
+
+#ifndef PERF_TRACE_CONSOLE
+bool perf_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != PERF_TRACE_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t             max_count = (length - 3) / sizeof(perf_trace_record_t);
+    uint8_t             count     = 0;
+    uint16_t            dropped   = 0;
+    perf_trace_record_t record;
+
+    memset(&data[1], 0, length - 1);
+    while (count < max_count && perf_trace_read(&record, 1, &dropped)) {
+        memcpy(&data[3 + count * sizeof(perf_trace_record_t)], &record, sizeof(perf_trace_record_t));
+        count++;
+    }
+    data[1] = count;
+    data[2] = MIN(dropped, UINT8_MAX);
+    return true;
+}
+#endif // PERF_TRACE_CONSOLE
+
+void perf_trace_task(void) {
+#ifdef PERF_TRACE_CONSOLE
+    static const char hex[] = "0123456789ABCDEF";
+    static uint32_t   last_drain = 0;
+
+    // Draining in batches keeps the console out of most of the passes being traced
+    uint16_t buffered = load_head() - perf_trace_tail;
+    if (buffered < PERF_TRACE_BUFFER_SIZE / 2 && (buffered == 0 || timer_elapsed32(last_drain) < PERF_TRACE_DRAIN_INTERVAL)) {
+        return;
+    }
+    last_drain = timer_read32();
+
+    // Everything buffered goes out, bounded in case writers keep up with the console
+    for (uint8_t batch = 0; batch < PERF_TRACE_BUFFER_SIZE / PERF_TRACE_DRAIN_RECORDS + 1; batch++) {
+        perf_trace_record_t records[PERF_TRACE_DRAIN_RECORDS];
+        uint16_t            dropped = 0;
+        uint8_t             count   = perf_trace_read(records, ARRAY_SIZE(records), &dropped);
+        if (count == 0 && dropped == 0) {
+            return;
+        }
+
+        // One line per batch: "perf_trace:<dropped>:<records>", all hex encoded little-endian bytes.
+        char           line[sizeof(records) * 2 + 1];
+        const uint8_t *bytes = (const uint8_t *)records;
+        for (uint8_t i = 0; i < count * sizeof(perf_trace_record_t); i++) {
+            line[i * 2]     = hex[bytes[i] >> 4];
+            line[i * 2 + 1] = hex[bytes[i] & 0xF];
+        }
+        line[count * sizeof(perf_trace_record_t) * 2] = '\0';
+        xprintf("perf_trace:%04X:%s\n", dropped, line);
+
+        if (count < ARRAY_SIZE(records)) {
+            return;
+        }
+    }
+#endif
+}
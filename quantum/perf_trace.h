@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Hot-path tracing into a fixed size ring buffer.
+
+    Every stage probe (see stage_probe.h) is recorded as a begin and an end
+    event carrying a timestamp and a stage specific argument. Keymaps can add
+    their own instant events with perf_trace_event(). Records are drained in
+    binary form, on request over raw HID through perf_trace_raw_hid_receive()
+    or, with PERF_TRACE_CONSOLE, hex encoded over the console in batches by
+    perf_trace_task(), and decoded on the host with `qmk perf-trace`. There
+    is only ever one reader, so the transport is chosen at compile time.
+
+    Writers never block. A record is published by its sequence number, which
+    is written last. When the reader falls behind the oldest records are
+    overwritten, which the reader detects and reports as dropped records.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "stage_probe.h"
+#include "util.h"
+
+#ifndef PERF_TRACE_BUFFER_SIZE
+#    define PERF_TRACE_BUFFER_SIZE 64
+#endif
+
+_Static_assert((PERF_TRACE_BUFFER_SIZE & (PERF_TRACE_BUFFER_SIZE - 1)) == 0, "PERF_TRACE_BUFFER_SIZE must be a power of two");
+
+#ifndef PERF_TRACE_RAW_HID_COMMAND
+#    define PERF_TRACE_RAW_HID_COMMAND 0xFE
+#endif
+
+/* Event ids below PERF_TRACE_EVENT_USER are (stage << 1) | is_end. */
+#define PERF_TRACE_EVENT_BEGIN(stage) ((uint8_t)((stage) << 1))
+#define PERF_TRACE_EVENT_END(stage) ((uint8_t)(((stage) << 1) | 1))
+#define PERF_TRACE_EVENT_USER 0x80
+
+typedef struct PACKED {
+    uint32_t timestamp;
+    uint16_t arg;
+    uint8_t  event;
+    uint8_t  sequence;
+} perf_trace_record_t;
+
+_Static_assert(sizeof(perf_trace_record_t) == 8, "perf_trace_record_t must be 8 bytes");
+
+/**
+ * \brief Appends an instant event to the trace.
+ *
+ * \param event An id of PERF_TRACE_EVENT_USER or above.
+ * \param arg A free-form argument.
+ */
+void perf_trace_event(uint8_t event, uint16_t arg);
+
+/**
+ * \brief Copies out and consumes the oldest records.
+ *
+ * \param records Destination for at most `max_count` records.
+ * \param max_count Capacity of `records`.
+ * \param dropped Incremented by the number of records overwritten since the last read, may be NULL.
+ * \return The number of records copied.
+ */
+uint8_t perf_trace_read(perf_trace_record_t *records, uint8_t max_count, uint16_t *dropped);
+
+/** \brief Stops or resumes recording, for example while draining a snapshot. */
+void perf_trace_set_enabled(bool enabled);
+bool perf_trace_is_enabled(void);
+
+/** \brief Discards all buffered records. */
+void perf_trace_clear(void);
+
+/**
+ * \brief Fills a raw HID report with buffered records.
+ *
+ * Call from raw_hid_receive() (or raw_hid_receive_kb() with VIA). If `data[0]`
+ * is PERF_TRACE_RAW_HID_COMMAND the report is overwritten with the record count
+ * in `data[1]`, the saturated dropped count in `data[2]` and the packed records
+ * from `data[3]` onwards, and true is returned. The caller sends it back.
+ */
+#ifndef PERF_TRACE_CONSOLE
+bool perf_trace_raw_hid_receive(uint8_t *data, uint8_t length);
+#endif
+
+/**
+ * \brief Drains all buffered records over the console with PERF_TRACE_CONSOLE,
+ * called from keyboard_task(). Only drains once the buffer is half full or
+ * PERF_TRACE_DRAIN_INTERVAL ms after the last drain.
+ */
+void perf_trace_task(void);
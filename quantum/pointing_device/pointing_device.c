@@ -40,15 +40,61 @@
 report_mouse_t shared_mouse_report = {};
 uint16_t       shared_cpi          = 0;
 
+// Motion of the other side not yet passed on, so nothing is lost to clamping or to reads between tasks
+static int32_t shared_motion_x = 0;
+static int32_t shared_motion_y = 0;
+static int32_t shared_motion_h = 0;
+static int32_t shared_motion_v = 0;
+
+/**
+ * @brief Adds motion of the other side to be sent by pointing device task
+ *
+ * Motion is accumulated until the next pointing device task, which passes on
+ * as much of it as fits a report and keeps the rest for the following one.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] x int16_t
+ * @param[in] y int16_t
+ * @param[in] h int16_t
+ * @param[in] v int16_t
+ * @param[in] buttons uint8_t current buttons, replacing the previous ones
+ */
+void pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons) {
+    shared_motion_x += x;
+    shared_motion_y += y;
+    shared_motion_h += h;
+    shared_motion_v += v;
+    shared_mouse_report.buttons = buttons;
+}
+
 /**
  * @brief Sets the shared mouse report used be pointing device task
  *
+ * The movement of the report is added to any not yet sent, see pointing_device_add_shared_motion.
+ *
  * NOTE : Only available when using SPLIT_POINTING_ENABLE
  *
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
-    shared_mouse_report = new_mouse_report;
+    pointing_device_add_shared_motion(new_mouse_report.x, new_mouse_report.y, new_mouse_report.h, new_mouse_report.v, new_mouse_report.buttons);
+}
+
+static int32_t pointing_device_take_shared_motion(int32_t *motion, int32_t min, int32_t max) {
+    int32_t value = *motion < min ? min : *motion > max ? max : *motion;
+    *motion -= value;
+    return value;
+}
+
+/**
+ * @brief Moves the accumulated motion of the other side into the shared report
+ */
+static void pointing_device_update_shared_report(void) {
+    shared_mouse_report.x = pointing_device_take_shared_motion(&shared_motion_x, XY_REPORT_MIN, XY_REPORT_MAX);
+    shared_mouse_report.y = pointing_device_take_shared_motion(&shared_motion_y, XY_REPORT_MIN, XY_REPORT_MAX);
+    shared_mouse_report.h = pointing_device_take_shared_motion(&shared_motion_h, INT8_MIN, INT8_MAX);
+    shared_mouse_report.v = pointing_device_take_shared_motion(&shared_motion_v, INT8_MIN, INT8_MAX);
 }
 
 /**
@@ -239,6 +285,13 @@ __attribute__((weak)) bool pointing_device_task(void) {
     last_exec = timer_read32();
 #endif
 
+#if defined(SPLIT_POINTING_ENABLE)
+#    if defined(SPLIT_POINTING_POLL_INTERVAL)
+    transaction_pointing_poll();
+#    endif
+    pointing_device_update_shared_report();
+#endif
+
     // Gather report info
 #ifdef POINTING_DEVICE_MOTION_PIN
 #    if defined(SPLIT_POINTING_ENABLE)
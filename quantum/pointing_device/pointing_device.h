@@ -117,6 +117,7 @@ void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
+void     pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
@@ -27,6 +27,13 @@
 #include "action_util.h"
 #include "keymap_introspection.h"
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+// Measure the combo term between the scan times of the keys
+#    define COMBO_EVENT_TIME(record) ((record)->event.time)
+#else
+#    define COMBO_EVENT_TIME(record) timer_read()
+#endif
+
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
 #ifndef COMBO_ONLY_FROM_LAYER
@@ -447,7 +454,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (timer && TIMER_DIFF_16(COMBO_EVENT_TIME(record), timer) > time) {
                 DISABLE_COMBO(combo);
                 return true;
             } else
@@ -575,10 +582,10 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    ifdef COMBO_STRICT_TIMER
         if (!timer) {
             // timer is set only on the first key
-            timer = timer_read();
+            timer = COMBO_EVENT_TIME(record);
         }
 #    else
-        timer = timer_read();
+        timer = COMBO_EVENT_TIME(record);
 #    endif
 #endif
 
@@ -178,6 +178,9 @@ __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_
 
 void shutdown_quantum(void) {
     clear_keyboard();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    dynamic_keymap_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -500,6 +503,10 @@ __attribute__((weak)) void startup_user(void) {}
 __attribute__((weak)) void shutdown_user(void) {}
 
 void suspend_power_down_quantum(void) {
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_MIRROR)
+    // Power may be cut while suspended, don't leave keymap changes in RAM only
+    dynamic_keymap_flush();
+#endif
     suspend_power_down_kb();
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
@@ -23,18 +23,175 @@
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#include "util.h"
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_ASYNC_FLUSH
+// The queue only carries the writes of the I2C drivers in rgb_matrix_drivers.c
+#    if !defined(PROTOCOL_CHIBIOS) || !(defined(IS31FL3731) || defined(IS31FL3733) || defined(IS31FL3736) || defined(IS31FL3737) || defined(IS31FL3741) || defined(IS31FLCOMMON) || defined(CKLED2001))
+#        error "RGB_MATRIX_ASYNC_FLUSH requires ChibiOS and an I2C LED driver"
+#    endif
+#    include "i2c_master.h"
+#endif // RGB_MATRIX_ASYNC_FLUSH
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+
+void rgb_matrix_update_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+
+        g_led_geometry[i].dx    = dx;
+        g_led_geometry[i].dy    = dy;
+        g_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+}
+#endif // RGB_MATRIX_GEOMETRY_TABLE
+
+#ifdef RGB_MATRIX_GOVERNOR
+/*
+    The governor trades animation smoothness for keyboard responsiveness at
+    runtime. Over each window it counts the runs of rgb_matrix_task, one per
+    keyboard_task loop, and the time spent rendering and flushing. When the
+    loop rate falls below RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE and the lighting
+    takes a real share of the time, it renders fewer LEDs per run and spaces
+    the frames further apart, down to RGB_MATRIX_GOVERNOR_MIN_PROCESS_LIMIT
+    LEDs and up to RGB_MATRIX_GOVERNOR_MAX_INTERVAL. With headroom to spare it
+    moves back towards RGB_MATRIX_LED_FLUSH_LIMIT and rendering every LED in
+    one go. The new values take effect at the start of the next frame.
+
+    The loads need a clock much finer than a task run, so they are only
+    measured with the ChibiOS realtime counter. Elsewhere the governor backs
+    off on the loop rate alone.
+*/
+
+#    ifndef RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE
+#        define RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE 1000
+#    endif
+
+#    ifndef RGB_MATRIX_GOVERNOR_MIN_LOAD
+#        define RGB_MATRIX_GOVERNOR_MIN_LOAD 100
+#    endif
+
+#    ifndef RGB_MATRIX_GOVERNOR_MIN_PROCESS_LIMIT
+#        define RGB_MATRIX_GOVERNOR_MIN_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 15) / 16)
+#    endif
+
+#    ifndef RGB_MATRIX_GOVERNOR_MAX_INTERVAL
+#        define RGB_MATRIX_GOVERNOR_MAX_INTERVAL 100
+#    endif
+
+#    ifndef RGB_MATRIX_GOVERNOR_WINDOW
+#        define RGB_MATRIX_GOVERNOR_WINDOW 250
+#    endif
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        if defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+#            define RGB_MATRIX_GOVERNOR_LOADS
+#            define RGB_MATRIX_GOVERNOR_TIMESTAMP() ((uint32_t)chSysGetRealtimeCounterX())
+#        endif
+#    endif
+
+#    if RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+uint8_t g_rgb_process_limit = RGB_MATRIX_LED_PROCESS_LIMIT;
+#    else
+uint8_t g_rgb_process_limit = RGB_MATRIX_LED_COUNT;
+#    endif
+static uint16_t                    rgb_flush_interval = RGB_MATRIX_LED_FLUSH_LIMIT;
+static rgb_matrix_governor_stats_t rgb_governor_stats;
+
+static struct {
+    uint32_t timer;
+    uint32_t runs;
+#    ifdef RGB_MATRIX_GOVERNOR_LOADS
+    uint32_t timestamp;
+    uint32_t render_ticks;
+    uint32_t flush_ticks;
+#    endif
+    uint16_t frames;
+    uint16_t report_timer;
+} rgb_governor_window;
+
+static void rgb_governor_start_window(void) {
+    rgb_governor_window.timer = sync_timer_read32();
+    rgb_governor_window.runs  = 0;
+#    ifdef RGB_MATRIX_GOVERNOR_LOADS
+    rgb_governor_window.timestamp    = RGB_MATRIX_GOVERNOR_TIMESTAMP();
+    rgb_governor_window.render_ticks = 0;
+    rgb_governor_window.flush_ticks  = 0;
+#    endif
+    rgb_governor_window.frames = 0;
+}
+
+static void rgb_governor_adjust(void) {
+    uint32_t elapsed = sync_timer_elapsed32(rgb_governor_window.timer);
+    if (elapsed < RGB_MATRIX_GOVERNOR_WINDOW) {
+        return;
+    }
+
+    rgb_governor_stats.scan_rate  = rgb_governor_window.runs * 1000 / elapsed;
+    rgb_governor_stats.frame_rate = (uint32_t)rgb_governor_window.frames * 1000 / elapsed;
+
+#    ifdef RGB_MATRIX_GOVERNOR_LOADS
+    // Loads are relative to the window as measured by the same clock
+    uint32_t ticks_per_mille = (RGB_MATRIX_GOVERNOR_TIMESTAMP() - rgb_governor_window.timestamp) / 1000;
+    if (ticks_per_mille == 0) {
+        ticks_per_mille = 1;
+    }
+    rgb_governor_stats.render_load = MIN(rgb_governor_window.render_ticks / ticks_per_mille, 1000);
+    rgb_governor_stats.flush_load  = MIN(rgb_governor_window.flush_ticks / ticks_per_mille, 1000);
+
+    // Slowing the lighting down only helps when it is what holds the loop up
+    bool lighting_bound = rgb_governor_stats.render_load + rgb_governor_stats.flush_load >= RGB_MATRIX_GOVERNOR_MIN_LOAD;
+#    else
+    bool lighting_bound = true;
+#    endif
+
+    if (rgb_governor_stats.scan_rate < RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE) {
+        if (lighting_bound) {
+            // Back off quickly so scanning recovers within a window or two
+            g_rgb_process_limit = MAX(g_rgb_process_limit - g_rgb_process_limit / 4, MIN(RGB_MATRIX_GOVERNOR_MIN_PROCESS_LIMIT, g_rgb_process_limit));
+            rgb_flush_interval  = MIN(rgb_flush_interval + rgb_flush_interval / 4 + 1, RGB_MATRIX_GOVERNOR_MAX_INTERVAL);
+        }
+    } else if (rgb_governor_stats.scan_rate > RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE + RGB_MATRIX_GOVERNOR_MIN_SCAN_RATE / 8) {
+        // Recover by an eighth, slower than the back off so the two do not oscillate
+        g_rgb_process_limit = MIN(g_rgb_process_limit + g_rgb_process_limit / 8 + 1, RGB_MATRIX_LED_COUNT);
+        if (rgb_flush_interval > RGB_MATRIX_LED_FLUSH_LIMIT) {
+            rgb_flush_interval = MAX(rgb_flush_interval - rgb_flush_interval / 8 - 1, RGB_MATRIX_LED_FLUSH_LIMIT);
+        }
+    }
+    rgb_governor_stats.flush_interval = rgb_flush_interval;
+    rgb_governor_stats.process_limit  = g_rgb_process_limit;
+
+#    ifdef CONSOLE_ENABLE
+    rgb_governor_window.report_timer += elapsed;
+    if (rgb_governor_window.report_timer >= 1000) {
+        rgb_governor_window.report_timer = 0;
+        dprintf("rgb governor: scan %lu/s, %u fps, render %u/1000, flush %u/1000, interval %ums, leds/run %u\n", rgb_governor_stats.scan_rate, rgb_governor_stats.frame_rate, rgb_governor_stats.render_load, rgb_governor_stats.flush_load, rgb_governor_stats.flush_interval, rgb_governor_stats.process_limit);
+    }
+#    endif
+
+    rgb_governor_start_window();
+}
+
+void rgb_matrix_governor_get_stats(rgb_matrix_governor_stats_t *stats) {
+    *stats = rgb_governor_stats;
+}
+#endif // RGB_MATRIX_GOVERNOR
+
 __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
@@ -116,6 +273,13 @@ uint32_t     g_rgb_timer;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #endif // RGB_MATRIX_FRAMEBUFFER_EFFECTS
+#ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+#    ifndef RGB_MATRIX_SPLIT
+#        error "RGB_MATRIX_SPLIT_FRAMEBUFFER requires RGB_MATRIX_SPLIT"
+#    endif
+// Every LED color set on the master, the slave half of it is mirrored to the slave
+uint8_t g_rgb_split_framebuffer[RGB_MATRIX_LED_COUNT][3];
+#endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -193,10 +357,37 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 }
 
 void rgb_matrix_update_pwm_buffers(void) {
+#ifdef RGB_MATRIX_ASYNC_FLUSH
+    // Queue the writes and return while they are sent
+    i2c_queue_begin();
+    if (i2c_queue_failed()) {
+        // Some of the previous frame never made it, so send everything again
+        rgb_matrix_driver_invalidate();
+    }
+    rgb_matrix_driver.flush();
+    i2c_queue_end();
+#else
     rgb_matrix_driver.flush();
+#endif // RGB_MATRIX_ASYNC_FLUSH
+}
+
+// Whether the previous flush is still being sent to the drivers
+static inline bool rgb_matrix_flush_busy(void) {
+#ifdef RGB_MATRIX_ASYNC_FLUSH
+    return i2c_queue_busy();
+#else
+    return false;
+#endif // RGB_MATRIX_ASYNC_FLUSH
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        g_rgb_split_framebuffer[index][0] = red;
+        g_rgb_split_framebuffer[index][1] = green;
+        g_rgb_split_framebuffer[index][2] = blue;
+    }
+#endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
     rgb_matrix_driver.set_color(index, red, green, blue);
 }
 
@@ -324,10 +515,19 @@ static void rgb_task_timers(void) {
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
     // next task
+#ifdef RGB_MATRIX_GOVERNOR
+    if (sync_timer_elapsed32(g_rgb_timer) >= rgb_flush_interval) rgb_task_state = STARTING;
+#else
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
+#endif // RGB_MATRIX_GOVERNOR
 }
 
 static void rgb_task_start(void) {
+#ifdef RGB_MATRIX_GOVERNOR
+    // The LED ranges of the iterations must not change within a frame
+    rgb_governor_adjust();
+#endif // RGB_MATRIX_GOVERNOR
+
     // reset iter
     rgb_effect_params.iter = 0;
 
@@ -414,6 +614,16 @@ static void rgb_task_flush(uint8_t effect) {
 }
 
 void rgb_matrix_task(void) {
+#ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+    // The slave shows what the master renders, its LEDs are set by the split transport
+    if (!is_keyboard_master()) {
+        if (!rgb_matrix_flush_busy()) {
+            rgb_matrix_update_pwm_buffers();
+        }
+        return;
+    }
+#endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
+
     rgb_task_timers();
 
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
@@ -426,6 +636,14 @@ void rgb_matrix_task(void) {
 
     uint8_t effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
 
+#ifdef RGB_MATRIX_GOVERNOR
+    rgb_task_states state = rgb_task_state;
+#    ifdef RGB_MATRIX_GOVERNOR_LOADS
+    uint32_t start = RGB_MATRIX_GOVERNOR_TIMESTAMP();
+#    endif
+    rgb_governor_window.runs++;
+#endif // RGB_MATRIX_GOVERNOR
+
     switch (rgb_task_state) {
         case STARTING:
             rgb_task_start();
@@ -441,12 +659,29 @@ void rgb_matrix_task(void) {
             }
             break;
         case FLUSHING:
+            // Keep scanning until the previous frame has been sent
+            if (rgb_matrix_flush_busy()) {
+                break;
+            }
             rgb_task_flush(effect);
             break;
         case SYNCING:
             rgb_task_sync();
             break;
     }
+
+#ifdef RGB_MATRIX_GOVERNOR
+#    ifdef RGB_MATRIX_GOVERNOR_LOADS
+    if (state == RENDERING) {
+        rgb_governor_window.render_ticks += RGB_MATRIX_GOVERNOR_TIMESTAMP() - start;
+    } else if (state == FLUSHING) {
+        rgb_governor_window.flush_ticks += RGB_MATRIX_GOVERNOR_TIMESTAMP() - start;
+    }
+#    endif
+    if (state == FLUSHING && rgb_task_state != FLUSHING) {
+        rgb_governor_window.frames++;
+    }
+#endif // RGB_MATRIX_GOVERNOR
 }
 
 void rgb_matrix_indicators(void) {
@@ -482,6 +717,14 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+    rgb_matrix_update_geometry();
+#endif // RGB_MATRIX_GEOMETRY_TABLE
+
+#ifdef RGB_MATRIX_GOVERNOR
+    rgb_governor_start_window();
+#endif // RGB_MATRIX_GOVERNOR
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -51,25 +51,32 @@
 #ifndef RGB_MATRIX_LED_PROCESS_LIMIT
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
-#define RGB_MATRIX_LED_PROCESS_MAX_ITERATIONS ((RGB_MATRIX_LED_COUNT + RGB_MATRIX_LED_PROCESS_LIMIT - 1) / RGB_MATRIX_LED_PROCESS_LIMIT)
+#ifdef RGB_MATRIX_GOVERNOR
+// Adjusted by the governor at the start of each frame
+extern uint8_t g_rgb_process_limit;
+#    define RGB_MATRIX_LED_PROCESS_CURRENT g_rgb_process_limit
+#else
+#    define RGB_MATRIX_LED_PROCESS_CURRENT RGB_MATRIX_LED_PROCESS_LIMIT
+#endif // RGB_MATRIX_GOVERNOR
+#define RGB_MATRIX_LED_PROCESS_MAX_ITERATIONS ((RGB_MATRIX_LED_COUNT + RGB_MATRIX_LED_PROCESS_CURRENT - 1) / RGB_MATRIX_LED_PROCESS_CURRENT)
 
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
-#    if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_GOVERNOR) || (defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT)
+#    if defined(RGB_MATRIX_SPLIT) && !defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
 #        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                                        \
-            uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);                                  \
-            uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;                                     \
+            uint8_t min = RGB_MATRIX_LED_PROCESS_CURRENT * (iter);                                \
+            uint8_t max = min + RGB_MATRIX_LED_PROCESS_CURRENT;                                   \
             if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;                           \
             uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;                                     \
             if (is_keyboard_left() && (max > k_rgb_matrix_split[0])) max = k_rgb_matrix_split[0]; \
             if (!(is_keyboard_left()) && (min < k_rgb_matrix_split[0])) min = k_rgb_matrix_split[0];
 #    else
-#        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)       \
-            uint8_t min = RGB_MATRIX_LED_PROCESS_LIMIT * (iter); \
-            uint8_t max = min + RGB_MATRIX_LED_PROCESS_LIMIT;    \
+#        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)         \
+            uint8_t min = RGB_MATRIX_LED_PROCESS_CURRENT * (iter); \
+            uint8_t max = min + RGB_MATRIX_LED_PROCESS_CURRENT;    \
             if (max > RGB_MATRIX_LED_COUNT) max = RGB_MATRIX_LED_COUNT;
 #    endif
 #else
-#    if defined(RGB_MATRIX_SPLIT)
+#    if defined(RGB_MATRIX_SPLIT) && !defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
 #        define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                                        \
             uint8_t       min                   = 0;                                              \
             uint8_t       max                   = RGB_MATRIX_LED_COUNT;                           \
@@ -246,7 +253,7 @@ typedef struct {
 } rgb_matrix_driver_t;
 
 static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_SPLIT) && !defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
     if (is_keyboard_left()) {
         uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
         return led_idx < k_rgb_matrix_split[0];
@@ -258,6 +265,10 @@ static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
 }
 
 extern const rgb_matrix_driver_t rgb_matrix_driver;
+#ifdef RGB_MATRIX_ASYNC_FLUSH
+// Makes the next flush rewrite every PWM register of the drivers
+void rgb_matrix_driver_invalidate(void);
+#endif
 
 extern rgb_config_t rgb_matrix_config;
 
@@ -269,3 +280,25 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+extern uint8_t g_rgb_split_framebuffer[RGB_MATRIX_LED_COUNT][3];
+#endif
+#ifdef RGB_MATRIX_GEOMETRY_TABLE
+extern led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+// Recomputes g_led_geometry, call after changing g_led_config at runtime
+void rgb_matrix_update_geometry(void);
+#endif
+
+#ifdef RGB_MATRIX_GOVERNOR
+typedef struct {
+    uint32_t scan_rate;      // rgb_matrix_task runs per second
+    uint16_t frame_rate;     // frames flushed per second
+    uint16_t render_load;    // per mille of the time spent rendering, ChibiOS only
+    uint16_t flush_load;     // per mille of the time spent flushing, ChibiOS only
+    uint16_t flush_interval; // current minimum time between frames, in milliseconds
+    uint8_t  process_limit;  // current number of LEDs rendered per task run
+} rgb_matrix_governor_stats_t;
+
+// Fills in the figures of the last governor window
+void rgb_matrix_governor_get_stats(rgb_matrix_governor_stats_t *stats);
+#endif
@@ -393,6 +393,26 @@ const rgb_matrix_driver_t rgb_matrix_driver = {
 };
 #    endif
 
+#    ifdef RGB_MATRIX_ASYNC_FLUSH
+void rgb_matrix_driver_invalidate(void) {
+#        if defined(IS31FL3731)
+    is31fl3731_invalidate_pwm_buffers();
+#        elif defined(IS31FL3733)
+    is31fl3733_invalidate_pwm_buffers();
+#        elif defined(IS31FL3736)
+    is31fl3736_invalidate_pwm_buffers();
+#        elif defined(IS31FL3737)
+    is31fl3737_invalidate_pwm_buffers();
+#        elif defined(IS31FL3741)
+    is31fl3741_invalidate_pwm_buffers();
+#        elif defined(IS31FLCOMMON)
+    IS31FL_common_invalidate_pwm_register();
+#        elif defined(CKLED2001)
+    ckled2001_invalidate_pwm_buffers();
+#        endif
+}
+#    endif // RGB_MATRIX_ASYNC_FLUSH
+
 #elif defined(AW20216)
 #    include "spi_master.h"
 
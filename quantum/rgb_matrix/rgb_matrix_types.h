@@ -82,6 +82,14 @@ typedef struct PACKED {
     uint8_t     flags[RGB_MATRIX_LED_COUNT];
 } led_config_t;
 
+// Position of an LED relative to k_rgb_matrix_center
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+
 typedef union {
     uint64_t raw;
     struct PACKED {
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#if defined(LED_MATRIX_SPLIT_FRAMEBUFFER) || defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
+
+#    include <string.h>
+#    include "split_framebuffer.h"
+
+_Static_assert(SPLIT_FRAMEBUFFER_BUDGET >= 5 && SPLIT_FRAMEBUFFER_BUDGET < 255, "SPLIT_FRAMEBUFFER_BUDGET must hold at least one record, and less than 255 bytes");
+
+#    define FB_PIXEL(fb, buffer, index) (&(buffer)[(index) * (fb)->pixel_size])
+
+static bool split_framebuffer_changed(const split_framebuffer_t *fb, uint8_t index) {
+    return fb->resync || memcmp(FB_PIXEL(fb, fb->pixels, index), FB_PIXEL(fb, fb->sent, index), fb->pixel_size) != 0;
+}
+
+static bool split_framebuffer_repeats(const split_framebuffer_t *fb, uint8_t index, uint8_t next) {
+    return next < fb->count && split_framebuffer_changed(fb, next) && memcmp(FB_PIXEL(fb, fb->pixels, index), FB_PIXEL(fb, fb->pixels, next), fb->pixel_size) == 0;
+}
+
+static void split_framebuffer_advance(split_framebuffer_t *fb, uint8_t leds) {
+    fb->cursor += leds;
+    if (fb->cursor >= fb->count) {
+        fb->cursor = 0;
+    }
+    fb->resync = fb->resync > leds ? fb->resync - leds : 0;
+}
+
+uint8_t split_framebuffer_encode(split_framebuffer_t *fb, uint8_t *buffer, uint8_t budget) {
+    uint8_t length = 0;
+    uint8_t looked = 0;
+
+    while (looked < fb->count && budget - length >= 2 + fb->pixel_size) {
+        uint8_t start = fb->cursor;
+        if (!split_framebuffer_changed(fb, start)) {
+            split_framebuffer_advance(fb, 1);
+            looked++;
+            continue;
+        }
+
+        // Repeated pixels become a single run, anything else is copied up to the next repeat
+        uint8_t leds = 1;
+        while (leds < SPLIT_FRAMEBUFFER_MAX_RECORD && split_framebuffer_repeats(fb, start, start + leds)) {
+            leds++;
+        }
+
+        uint8_t control = leds;
+        uint8_t pixels  = 1;
+        if (leds > 1) {
+            control |= SPLIT_FRAMEBUFFER_RUN;
+        } else {
+            uint8_t room = (budget - length - 2) / fb->pixel_size;
+            while (leds < SPLIT_FRAMEBUFFER_MAX_RECORD && leds < room && start + leds < fb->count && split_framebuffer_changed(fb, start + leds) && !split_framebuffer_repeats(fb, start + leds, start + leds + 1)) {
+                leds++;
+            }
+            control = pixels = leds;
+        }
+
+        buffer[length++] = start;
+        buffer[length++] = control;
+        memcpy(&buffer[length], FB_PIXEL(fb, fb->pixels, start), pixels * fb->pixel_size);
+        length += pixels * fb->pixel_size;
+
+        memcpy(FB_PIXEL(fb, fb->sent, start), FB_PIXEL(fb, fb->pixels, start), leds * fb->pixel_size);
+        split_framebuffer_advance(fb, leds);
+        looked += leds;
+    }
+
+    return length;
+}
+
+void split_framebuffer_invalidate(split_framebuffer_t *fb) {
+    fb->resync = fb->count;
+}
+
+bool split_framebuffer_decode(uint8_t *pixels, uint8_t pixel_size, uint8_t count, const uint8_t *buffer, uint8_t length) {
+    bool updated = false;
+
+    while (length >= 2) {
+        uint8_t  start = buffer[0];
+        uint8_t  leds  = buffer[1] & SPLIT_FRAMEBUFFER_MAX_RECORD;
+        bool     run   = buffer[1] & SPLIT_FRAMEBUFFER_RUN;
+        uint16_t data  = (run ? 1 : leds) * pixel_size;
+        buffer += 2;
+        length -= 2;
+
+        // Stop at the first record that does not fit, it can only be garbage
+        if (leds == 0 || start + leds > count || data > length) {
+            break;
+        }
+
+        for (uint8_t i = 0; i < leds; i++) {
+            memcpy(&pixels[(start + i) * pixel_size], run ? buffer : &buffer[i * pixel_size], pixel_size);
+        }
+        buffer += data;
+        length -= data;
+        updated = true;
+    }
+
+    return updated;
+}
+
+#endif // defined(LED_MATRIX_SPLIT_FRAMEBUFFER) || defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
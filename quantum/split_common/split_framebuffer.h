@@ -0,0 +1,54 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Delta encoding of the LED framebuffer mirrored from the master to the slave.
+
+    The encoded buffer is a sequence of records, each starting with the offset
+    of its first LED within the slave half and a control byte. The low 7 bits
+    of the control byte hold the number of LEDs covered. With
+    SPLIT_FRAMEBUFFER_RUN set a single pixel follows and applies to all of
+    them, otherwise one pixel per LED follows.
+
+    Only LEDs that differ from what the slave was last sent are encoded,
+    starting where the previous buffer stopped, so a budget smaller than the
+    whole framebuffer still reaches every LED in turn.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SPLIT_FRAMEBUFFER_BUDGET
+#    define SPLIT_FRAMEBUFFER_BUDGET 32
+#endif
+
+#define SPLIT_FRAMEBUFFER_RUN 0x80
+#define SPLIT_FRAMEBUFFER_MAX_RECORD 0x7F
+
+typedef struct {
+    const uint8_t *pixels;     // pixel_size bytes per LED, as rendered by the master
+    uint8_t       *sent;       // what the slave was last sent, same layout as pixels
+    uint8_t        pixel_size; // 3 for RGB, 1 for single color
+    uint8_t        count;      // LEDs on the slave half
+    uint8_t        cursor;     // next LED to look at
+    uint8_t        resync;     // LEDs left to send even if unchanged
+} split_framebuffer_t;
+
+// First LED and number of LEDs of the slave half, given the LED counts of both halves
+static inline uint8_t split_framebuffer_slave_first(const uint8_t split[2], bool slave_is_left) {
+    return slave_is_left ? 0 : split[0];
+}
+
+static inline uint8_t split_framebuffer_slave_count(const uint8_t split[2], bool slave_is_left) {
+    return slave_is_left ? split[0] : split[1];
+}
+
+/** \brief Encodes changed LEDs into at most budget bytes, and returns the bytes used. */
+uint8_t split_framebuffer_encode(split_framebuffer_t *fb, uint8_t *buffer, uint8_t budget);
+
+/** \brief Resends every LED, e.g. after a buffer may not have reached the slave. */
+void split_framebuffer_invalidate(split_framebuffer_t *fb);
+
+/** \brief Applies an encoded buffer to pixels, returns true if any LED was written. */
+bool split_framebuffer_decode(uint8_t *pixels, uint8_t pixel_size, uint8_t count, const uint8_t *buffer, uint8_t length);
@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "split_link_stats.h"
+#include "transaction_id_define.h"
+#include "timer.h"
+#include "print.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    if defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+#        define SPLIT_LINK_STATS_REALTIME_COUNTER
+#    endif
+#endif
+
+#ifndef SPLIT_LINK_STATS_HISTOGRAM_SHIFT
+#    ifdef SPLIT_LINK_STATS_REALTIME_COUNTER
+#        define SPLIT_LINK_STATS_HISTOGRAM_SHIFT 10
+#    else
+#        define SPLIT_LINK_STATS_HISTOGRAM_SHIFT 0
+#    endif
+#endif
+
+#define SATURATING_INCREMENT(counter) \
+    do {                              \
+        if ((counter) < UINT16_MAX) { \
+            (counter)++;              \
+        }                             \
+    } while (0)
+
+static split_link_stats_t        split_link_stats[NUM_TOTAL_TRANSACTIONS];
+static split_link_stats_global_t split_link_stats_global;
+
+uint32_t split_link_stats_timestamp(void) {
+#ifdef SPLIT_LINK_STATS_REALTIME_COUNTER
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    return timer_read32();
+#endif
+}
+
+void split_link_stats_record(int8_t id, bool okay, uint32_t start) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+
+    split_link_stats_t *stats = &split_link_stats[id];
+    uint32_t            ticks = split_link_stats_timestamp() - start;
+
+    SATURATING_INCREMENT(stats->transactions);
+    if (!okay) {
+        SATURATING_INCREMENT(stats->failures);
+    }
+    stats->total_ticks = stats->total_ticks + ticks < stats->total_ticks ? UINT32_MAX : stats->total_ticks + ticks;
+    if (ticks > stats->max_ticks) {
+        stats->max_ticks = ticks;
+    }
+
+    uint8_t bucket = 0;
+    for (uint32_t scaled = ticks >> (SPLIT_LINK_STATS_HISTOGRAM_SHIFT + 1); scaled && bucket < SPLIT_LINK_STATS_BUCKETS - 1; scaled >>= 1) {
+        bucket++;
+    }
+    SATURATING_INCREMENT(stats->histogram[bucket]);
+}
+
+void split_link_stats_record_checksum_error(int8_t id) {
+    if (id >= 0 && id < NUM_TOTAL_TRANSACTIONS) {
+        SATURATING_INCREMENT(split_link_stats[id].checksum_errors);
+    }
+}
+
+void split_link_stats_record_retry(bool gave_up) {
+    if (gave_up) {
+        SATURATING_INCREMENT(split_link_stats_global.gave_up);
+    } else {
+        SATURATING_INCREMENT(split_link_stats_global.retries);
+    }
+}
+
+void split_link_stats_record_speed_step(uint8_t step) {
+    split_link_stats_global.speed_step = step;
+}
+
+const split_link_stats_t *split_link_stats_get(int8_t id) {
+    return id >= 0 && id < NUM_TOTAL_TRANSACTIONS ? &split_link_stats[id] : NULL;
+}
+
+const split_link_stats_global_t *split_link_stats_get_global(void) {
+    return &split_link_stats_global;
+}
+
+void split_link_stats_clear(void) {
+    memset(split_link_stats, 0, sizeof(split_link_stats));
+    split_link_stats_global.retries = 0;
+    split_link_stats_global.gave_up = 0;
+}
+
+void split_link_stats_print(void) {
+#ifdef CONSOLE_ENABLE
+    // "split_link:<id>:<transactions>:<failures>:<checksum errors>:<total ticks>:<max ticks>:<histogram>", in hex
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_link_stats_t *stats = &split_link_stats[id];
+        if (!stats->transactions && !stats->checksum_errors) {
+            continue;
+        }
+        xprintf("split_link:%02X:%04X:%04X:%04X:%08lX:%08lX:", id, stats->transactions, stats->failures, stats->checksum_errors, (unsigned long)stats->total_ticks, (unsigned long)stats->max_ticks);
+        for (uint8_t i = 0; i < SPLIT_LINK_STATS_BUCKETS; i++) {
+            xprintf(i ? ",%04X" : "%04X", stats->histogram[i]);
+        }
+        xprintf("\n");
+    }
+    xprintf("split_link:global:%04X:%04X:%02X\n", split_link_stats_global.retries, split_link_stats_global.gave_up, split_link_stats_global.speed_step);
+#endif
+}
+
+bool split_link_stats_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 + sizeof(split_link_stats_t) || data[0] != SPLIT_LINK_STATS_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t id    = data[1];
+    bool    clear = data[2];
+    memset(&data[2], 0, length - 2);
+    if (id == 0xFF) {
+        memcpy(&data[2], &split_link_stats_global, sizeof(split_link_stats_global));
+    } else if (id < NUM_TOTAL_TRANSACTIONS) {
+        memcpy(&data[2], &split_link_stats[id], sizeof(split_link_stats_t));
+    }
+
+    if (clear) {
+        split_link_stats_clear();
+    }
+    return true;
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Split link quality counters.
+
+    With SPLIT_LINK_STATS_ENABLE every transaction the master executes is
+    counted per transaction id, together with its failures, checksum
+    mismatches and a latency histogram. Retries of the transaction handlers
+    are counted globally. Durations are in SPLIT_LINK_STATS_TIMESTAMP() ticks,
+    the ChibiOS realtime counter where available and milliseconds otherwise,
+    and histogram bucket i counts transactions that took below
+    2^(i + 1 + SPLIT_LINK_STATS_HISTOGRAM_SHIFT) ticks, the last bucket
+    taking everything slower. All counters saturate.
+
+    The counters can be dumped over the console with split_link_stats_print(),
+    or read over raw HID through split_link_stats_raw_hid_receive().
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef SPLIT_LINK_STATS_RAW_HID_COMMAND
+#    define SPLIT_LINK_STATS_RAW_HID_COMMAND 0xFD
+#endif
+
+#define SPLIT_LINK_STATS_BUCKETS 8
+
+typedef struct __attribute__((packed)) {
+    uint16_t transactions;                      // executed, including retries
+    uint16_t failures;                          // reported failed by the transport
+    uint16_t checksum_errors;                   // transferred, but the data did not match its checksum
+    uint32_t total_ticks;                       // summed duration, for the mean
+    uint32_t max_ticks;                         // slowest transaction
+    uint16_t histogram[SPLIT_LINK_STATS_BUCKETS];
+} split_link_stats_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t retries;    // transaction handlers run again after a failure
+    uint16_t gave_up;    // transaction handlers that failed every retry
+    uint8_t  speed_step; // current serial speed step, see SERIAL_USART_SPEED_NEGOTIATION
+} split_link_stats_global_t;
+
+#ifdef SPLIT_LINK_STATS_ENABLE
+
+/** \brief Timestamp for split_link_stats_record(). */
+uint32_t split_link_stats_timestamp(void);
+
+/** \brief Records one transaction started at `start`, called by the transport. */
+void split_link_stats_record(int8_t id, bool okay, uint32_t start);
+void split_link_stats_record_checksum_error(int8_t id);
+void split_link_stats_record_retry(bool gave_up);
+void split_link_stats_record_speed_step(uint8_t step);
+
+const split_link_stats_t        *split_link_stats_get(int8_t id);
+const split_link_stats_global_t *split_link_stats_get_global(void);
+void                             split_link_stats_clear(void);
+
+/** \brief Prints one line per transaction id that was used, and one for the global counters. */
+void split_link_stats_print(void);
+
+/**
+ * \brief Answers a raw HID stats request.
+ *
+ * Call from raw_hid_receive() (or raw_hid_receive_kb() with VIA). If `data[0]`
+ * is SPLIT_LINK_STATS_RAW_HID_COMMAND, the report is overwritten with the
+ * split_link_stats_t of transaction id `data[1]` from `data[2]` onwards, or with
+ * the split_link_stats_global_t for an id of 0xFF, and true is returned. A
+ * nonzero `data[2]` in the request clears all counters after reading. The
+ * caller sends the report back.
+ */
+bool split_link_stats_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#    define SPLIT_LINK_STATS_TIMESTAMP() split_link_stats_timestamp()
+#    define SPLIT_LINK_STATS_RECORD(id, okay, start) split_link_stats_record(id, okay, start)
+#    define SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(id) split_link_stats_record_checksum_error(id)
+#    define SPLIT_LINK_STATS_RECORD_RETRY(gave_up) split_link_stats_record_retry(gave_up)
+#    define SPLIT_LINK_STATS_RECORD_SPEED_STEP(step) split_link_stats_record_speed_step(step)
+
+#else // SPLIT_LINK_STATS_ENABLE
+
+#    define SPLIT_LINK_STATS_TIMESTAMP() 0
+#    define SPLIT_LINK_STATS_RECORD(id, okay, start) \
+        do {                                         \
+            (void)(start);                           \
+        } while (0)
+#    define SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(id) \
+        do {                                           \
+        } while (0)
+#    define SPLIT_LINK_STATS_RECORD_RETRY(gave_up) \
+        do {                                       \
+        } while (0)
+#    define SPLIT_LINK_STATS_RECORD_SPEED_STEP(step) \
+        do {                                         \
+        } while (0)
+
+#endif // SPLIT_LINK_STATS_ENABLE
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "config_mock.h"
+
+#define LED_MATRIX_LED_COUNT 48
+#define LED_MATRIX_SPLIT \
+    { 24, 24 }
+#define LED_MATRIX_SPLIT_FRAMEBUFFER
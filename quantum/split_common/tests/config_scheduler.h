@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "config_mock.h"
+
+#define SPLIT_ACTIVITY_ENABLE
+#define SPLIT_TRANSACTION_SCHEDULER
+#define SPLIT_TRANSACTION_BUDGET_US 1000
+#define SPLIT_ACTIVITY_THROTTLE_MS 20
@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include "split_link_sim.h"
+
+bool is_keyboard_master(void) {
+    return !split_link_sim_is_target();
+}
+
+bool usb_connected_state(void) {
+    return true;
+}
+
+bool usb_vbus_state(void) {
+    return true;
+}
+
+void usb_disconnect(void) {}
+
+#ifdef LED_MATRIX_ENABLE
+#    include "led_matrix.h"
+
+led_eeconfig_t led_matrix_eeconfig;
+uint8_t        g_led_split_framebuffer[LED_MATRIX_LED_COUNT];
+// Values the slave handed to its driver
+uint8_t mock_slave_leds[LED_MATRIX_LED_COUNT];
+
+static bool led_suspend_state = false;
+
+bool led_matrix_get_suspend_state(void) {
+    return led_suspend_state;
+}
+
+void led_matrix_set_suspend_state(bool state) {
+    led_suspend_state = state;
+}
+
+static void mock_set_value(int index, uint8_t value) {
+    mock_slave_leds[index] = value;
+}
+
+const led_matrix_driver_t led_matrix_driver = {.set_value = mock_set_value};
+
+// Both halves share g_led_split_framebuffer, so the target claims the left
+// half and decodes into LEDs the master leaves alone
+bool is_keyboard_left(void) {
+    return true;
+}
+#endif // LED_MATRIX_ENABLE
+
+#ifdef SPLIT_ACTIVITY_ENABLE
+uint32_t mock_matrix_activity_time = 0;
+// Timestamp the slave received
+uint32_t mock_slave_matrix_activity_time = 0;
+
+uint32_t last_matrix_activity_time(void) {
+    return mock_matrix_activity_time;
+}
+
+uint32_t last_encoder_activity_time(void) {
+    return 0;
+}
+
+uint32_t last_pointing_device_activity_time(void) {
+    return 0;
+}
+
+void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timestamp, uint32_t pointing_device_timestamp) {
+    mock_slave_matrix_activity_time = matrix_timestamp;
+}
+#endif // SPLIT_ACTIVITY_ENABLE
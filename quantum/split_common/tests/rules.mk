@@ -0,0 +1,63 @@
+split_transport_DEFS := -DNO_PRINT -DNO_DEBUG -DIGNORE_ATOMIC_BLOCK -DSPLIT_KEYBOARD -DSPLIT_COMMON_TRANSACTIONS -DSPLIT_TRANSPORT_MIRROR
+split_transport_INC := $(QUANTUM_PATH)/split_common $(PLATFORM_PATH)/test/drivers
+split_transport_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+split_transport_SRC := \
+	platforms/test/timer.c \
+	platforms/test/drivers/split_link_sim.c \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_util.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_transport_bundle_DEFS := $(split_transport_DEFS) -DSPLIT_TRANSACTION_BUNDLE
+split_transport_bundle_INC := $(split_transport_INC)
+split_transport_bundle_CONFIG := $(split_transport_CONFIG)
+split_transport_bundle_SRC := $(split_transport_SRC)
+
+split_transport_push_DEFS := $(split_transport_DEFS) -DSERIAL_USART_FULL_DUPLEX -DSPLIT_MATRIX_PUSH
+split_transport_push_INC := $(split_transport_INC)
+split_transport_push_CONFIG := $(split_transport_CONFIG)
+split_transport_push_SRC := \
+	$(filter-out %/split_transport_tests.cpp,$(split_transport_SRC)) \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_push_tests.cpp
+
+split_transport_scheduler_DEFS := $(split_transport_DEFS)
+split_transport_scheduler_INC := $(split_transport_INC)
+split_transport_scheduler_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_scheduler.h
+split_transport_scheduler_SRC := \
+	$(filter-out %/split_transport_tests.cpp,$(split_transport_SRC)) \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_scheduler_tests.cpp
+
+split_transport_timestamps_DEFS := $(split_transport_DEFS) -DMATRIX_SCAN_TIMESTAMPS
+split_transport_timestamps_INC := $(split_transport_INC)
+split_transport_timestamps_CONFIG := $(split_transport_CONFIG)
+split_transport_timestamps_SRC := \
+	$(filter-out %/split_transport_tests.cpp,$(split_transport_SRC)) \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_timestamps_tests.cpp \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/debounce/none.c
+
+split_transport_framebuffer_DEFS := $(split_transport_DEFS) -DLED_MATRIX_ENABLE
+split_transport_framebuffer_INC := $(split_transport_INC) $(QUANTUM_PATH)/led_matrix $(QUANTUM_PATH)/led_matrix/animations
+split_transport_framebuffer_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_framebuffer.h
+split_transport_framebuffer_SRC := \
+	$(split_transport_SRC) \
+	$(QUANTUM_PATH)/split_common/split_framebuffer.c
+
+split_framebuffer_DEFS := -DLED_MATRIX_SPLIT_FRAMEBUFFER
+split_framebuffer_INC := $(QUANTUM_PATH)/split_common
+split_framebuffer_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/split_framebuffer_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_framebuffer.c
+
+split_link_stats_DEFS := -DNO_PRINT -DNO_DEBUG -DSPLIT_KEYBOARD -DSPLIT_LINK_STATS_ENABLE
+split_link_stats_INC := $(QUANTUM_PATH)/split_common
+split_link_stats_CONFIG := $(split_transport_CONFIG)
+split_link_stats_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/split_common/tests/split_link_stats_tests.cpp \
+	$(QUANTUM_PATH)/split_common/split_link_stats.c
@@ -0,0 +1,126 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "split_framebuffer.h"
+}
+
+#define LEDS 40
+
+class SplitFramebuffer : public ::testing::Test {
+   protected:
+    uint8_t             pixels[LEDS * 3] = {};
+    uint8_t             sent[LEDS * 3]   = {};
+    uint8_t             slave[LEDS * 3]  = {};
+    split_framebuffer_t fb               = {};
+
+    void init(uint8_t pixel_size) {
+        fb.pixels     = pixels;
+        fb.sent       = sent;
+        fb.pixel_size = pixel_size;
+        fb.count      = LEDS;
+    }
+
+    // Encodes one buffer and applies it to the slave, returns the bytes used
+    uint8_t transfer(uint8_t budget = SPLIT_FRAMEBUFFER_BUDGET) {
+        uint8_t buffer[256];
+        uint8_t length = split_framebuffer_encode(&fb, buffer, budget);
+        EXPECT_LE(length, budget);
+        split_framebuffer_decode(slave, fb.pixel_size, fb.count, buffer, length);
+        return length;
+    }
+
+    bool slave_matches(void) {
+        return memcmp(pixels, slave, LEDS * fb.pixel_size) == 0;
+    }
+};
+
+TEST_F(SplitFramebuffer, NothingChangedEncodesNothing) {
+    init(3);
+    EXPECT_EQ(transfer(), 0);
+}
+
+TEST_F(SplitFramebuffer, SingleChangeIsOneRecord) {
+    init(3);
+    pixels[5 * 3 + 1] = 0x42;
+
+    uint8_t buffer[SPLIT_FRAMEBUFFER_BUDGET];
+    ASSERT_EQ(split_framebuffer_encode(&fb, buffer, sizeof(buffer)), 2 + 3);
+    EXPECT_EQ(buffer[0], 5);
+    EXPECT_EQ(buffer[1], 1);
+    EXPECT_EQ(buffer[3], 0x42);
+
+    // Sent LEDs are not sent again
+    EXPECT_EQ(split_framebuffer_encode(&fb, buffer, sizeof(buffer)), 0);
+}
+
+TEST_F(SplitFramebuffer, RepeatedPixelsBecomeARun) {
+    init(3);
+    for (int i = 0; i < LEDS; i++) {
+        pixels[i * 3] = 0x10;
+    }
+
+    uint8_t buffer[SPLIT_FRAMEBUFFER_BUDGET];
+    ASSERT_EQ(split_framebuffer_encode(&fb, buffer, sizeof(buffer)), 2 + 3);
+    EXPECT_EQ(buffer[0], 0);
+    EXPECT_EQ(buffer[1], SPLIT_FRAMEBUFFER_RUN | LEDS);
+
+    EXPECT_TRUE(split_framebuffer_decode(slave, 3, LEDS, buffer, 2 + 3));
+    EXPECT_TRUE(slave_matches());
+}
+
+TEST_F(SplitFramebuffer, ChangesBeyondBudgetFollowInLaterBuffers) {
+    init(3);
+    for (int i = 0; i < LEDS * 3; i++) {
+        pixels[i] = i;
+    }
+
+    int buffers = 0;
+    while (!slave_matches()) {
+        ASSERT_GT(transfer(), 0);
+        ASSERT_LT(++buffers, LEDS);
+    }
+    EXPECT_GT(buffers, 1);
+    EXPECT_EQ(transfer(), 0);
+}
+
+TEST_F(SplitFramebuffer, InvalidateResendsEverything) {
+    init(1);
+    for (int i = 0; i < LEDS; i++) {
+        pixels[i] = i;
+    }
+    while (transfer()) {
+    }
+    ASSERT_TRUE(slave_matches());
+
+    // Lost on the way
+    memset(slave, 0, sizeof(slave));
+    split_framebuffer_invalidate(&fb);
+    while (transfer()) {
+    }
+    EXPECT_TRUE(slave_matches());
+}
+
+TEST_F(SplitFramebuffer, DecodeStopsAtRecordsThatDoNotFit) {
+    const uint8_t beyond_count[] = {LEDS - 1, 2, 0xAA, 0xBB};
+    EXPECT_FALSE(split_framebuffer_decode(slave, 1, LEDS, beyond_count, sizeof(beyond_count)));
+
+    const uint8_t truncated[] = {0, 3, 0xAA, 0xBB};
+    EXPECT_FALSE(split_framebuffer_decode(slave, 1, LEDS, truncated, sizeof(truncated)));
+
+    const uint8_t empty_record[] = {0, 0, 0xAA};
+    EXPECT_FALSE(split_framebuffer_decode(slave, 1, LEDS, empty_record, sizeof(empty_record)));
+
+    // Records before the garbage still apply
+    const uint8_t partly[] = {1, 1, 0xAA, LEDS, 1, 0xBB};
+    EXPECT_TRUE(split_framebuffer_decode(slave, 1, LEDS, partly, sizeof(partly)));
+    EXPECT_EQ(slave[1], 0xAA);
+    for (int i = 0; i < LEDS; i++) {
+        if (i != 1) {
+            EXPECT_EQ(slave[i], 0) << "LED " << i;
+        }
+    }
+}
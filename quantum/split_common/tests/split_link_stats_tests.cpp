@@ -0,0 +1,117 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The transaction ids are checked in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "split_link_stats.h"
+#include "transaction_id_define.h"
+
+void advance_time(uint32_t ms);
+}
+
+class SplitLinkStats : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        split_link_stats_clear();
+    }
+
+    // Records a transaction of id that took ticks, in milliseconds on the test platform
+    void record(int8_t id, uint32_t ticks, bool okay = true) {
+        uint32_t start = split_link_stats_timestamp();
+        advance_time(ticks);
+        split_link_stats_record(id, okay, start);
+    }
+};
+
+TEST_F(SplitLinkStats, BucketsDoubleInWidth) {
+    // Bucket i counts durations below 2^(i + 1)
+    const uint32_t ticks[]  = {0, 1, 2, 3, 4, 7, 8, 127, 128, 255, 256, 100000};
+    const uint8_t  bucket[] = {0, 0, 1, 1, 2, 2, 3, 6, 7, 7, 7, 7};
+
+    for (size_t i = 0; i < sizeof(ticks) / sizeof(ticks[0]); i++) {
+        split_link_stats_clear();
+        record(0, ticks[i]);
+        const split_link_stats_t *stats = split_link_stats_get(0);
+        for (uint8_t b = 0; b < SPLIT_LINK_STATS_BUCKETS; b++) {
+            EXPECT_EQ(stats->histogram[b], b == bucket[i] ? 1 : 0) << ticks[i] << " ticks, bucket " << (int)b;
+        }
+        EXPECT_EQ(stats->max_ticks, ticks[i]);
+    }
+}
+
+TEST_F(SplitLinkStats, CountsFailuresAndDurations) {
+    record(1, 3);
+    record(1, 5, false);
+    record(1, 1);
+
+    const split_link_stats_t *stats = split_link_stats_get(1);
+    EXPECT_EQ(stats->transactions, 3);
+    EXPECT_EQ(stats->failures, 1);
+    EXPECT_EQ(stats->total_ticks, 9u);
+    EXPECT_EQ(stats->max_ticks, 5u);
+    EXPECT_EQ(split_link_stats_get(0)->transactions, 0);
+}
+
+TEST_F(SplitLinkStats, CountersSaturate) {
+    for (uint32_t i = 0; i < UINT16_MAX + 10u; i++) {
+        split_link_stats_record(0, false, split_link_stats_timestamp());
+        split_link_stats_record_checksum_error(0);
+        split_link_stats_record_retry(false);
+        split_link_stats_record_retry(true);
+    }
+
+    const split_link_stats_t *stats = split_link_stats_get(0);
+    EXPECT_EQ(stats->transactions, UINT16_MAX);
+    EXPECT_EQ(stats->failures, UINT16_MAX);
+    EXPECT_EQ(stats->checksum_errors, UINT16_MAX);
+    EXPECT_EQ(stats->histogram[0], UINT16_MAX);
+    EXPECT_EQ(split_link_stats_get_global()->retries, UINT16_MAX);
+    EXPECT_EQ(split_link_stats_get_global()->gave_up, UINT16_MAX);
+}
+
+TEST_F(SplitLinkStats, TotalDurationSaturates) {
+    uint32_t now = split_link_stats_timestamp();
+    split_link_stats_record(0, true, now - 0xC0000000);
+    split_link_stats_record(0, true, now - 0xC0000000);
+
+    const split_link_stats_t *stats = split_link_stats_get(0);
+    EXPECT_EQ(stats->total_ticks, UINT32_MAX);
+    EXPECT_EQ(stats->max_ticks, 0xC0000000);
+}
+
+TEST_F(SplitLinkStats, IgnoresInvalidIds) {
+    record(-1, 1);
+    record(NUM_TOTAL_TRANSACTIONS, 1);
+    split_link_stats_record_checksum_error(NUM_TOTAL_TRANSACTIONS);
+
+    EXPECT_EQ(split_link_stats_get(-1), nullptr);
+    EXPECT_EQ(split_link_stats_get(NUM_TOTAL_TRANSACTIONS), nullptr);
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        EXPECT_EQ(split_link_stats_get(id)->transactions, 0);
+        EXPECT_EQ(split_link_stats_get(id)->checksum_errors, 0);
+    }
+}
+
+TEST_F(SplitLinkStats, RawHidReadsAndClears) {
+    record(2, 4);
+    split_link_stats_record_speed_step(1);
+
+    uint8_t report[32] = {SPLIT_LINK_STATS_RAW_HID_COMMAND, 2, 1};
+    ASSERT_TRUE(split_link_stats_raw_hid_receive(report, sizeof(report)));
+    split_link_stats_t read;
+    memcpy(&read, &report[2], sizeof(read));
+    EXPECT_EQ(read.transactions, 1);
+    EXPECT_EQ(read.total_ticks, 4u);
+
+    // Cleared after reading, except for the speed step
+    EXPECT_EQ(split_link_stats_get(2)->transactions, 0);
+    EXPECT_EQ(split_link_stats_get_global()->speed_step, 1);
+
+    uint8_t other[32] = {0x01, 2};
+    EXPECT_FALSE(split_link_stats_raw_hid_receive(other, sizeof(other)));
+}
@@ -0,0 +1,156 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The transaction ids are checked in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "split_link_sim.h"
+#include "split_util.h"
+#include "transport.h"
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+// Default of transactions.c
+#define SPLIT_MATRIX_PUSH_POLL_INTERVAL_US (100 * 1000)
+
+class SplitMatrixPush : public ::testing::Test {
+   protected:
+    split_link_sim_config_t config = SPLIT_LINK_SIM_DEFAULT_CONFIG;
+
+    matrix_row_t master_matrix[ROWS_PER_HAND]          = {}; // keys of the master half
+    matrix_row_t slave_matrix[ROWS_PER_HAND]           = {}; // keys of the slave half
+    matrix_row_t mirrored_master_matrix[ROWS_PER_HAND] = {}; // master keys as seen by the slave
+    matrix_row_t received_slave_matrix[ROWS_PER_HAND]  = {}; // slave keys as seen by the master
+
+    void SetUp() override {
+        split_link_sim_init(&config);
+        // The connection state of split_util.c outlives a test
+        for (int i = 0; i < 1000 && !is_transport_connected(); i++) {
+            scan(1000);
+        }
+        ASSERT_TRUE(is_transport_connected());
+
+        // Settle the pushes of an earlier test, then start right after a liveness poll
+        for (int i = 0; i < 2 * SPLIT_MATRIX_PUSH_POLL_INTERVAL_US / 1000; i++) {
+            scan(1000);
+        }
+        uint32_t transactions;
+        do {
+            transactions = split_link_sim_get_stats()->transactions;
+            scan(1000);
+        } while (split_link_sim_get_stats()->transactions == transactions);
+        ASSERT_TRUE(slave_matrix_received());
+        split_link_sim_clear_stats();
+    }
+
+    void target_scan(void) {
+        split_link_sim_target_task(mirrored_master_matrix, slave_matrix);
+    }
+
+    bool master_scan(void) {
+        return transport_master_if_connected(master_matrix, received_slave_matrix);
+    }
+
+    // Both halves scan once, then period_us pass until the next scan
+    bool scan(uint32_t period_us) {
+        target_scan();
+        bool okay = master_scan();
+        split_link_sim_advance_us(period_us);
+        return okay;
+    }
+
+    bool slave_matrix_received(void) {
+        return memcmp(slave_matrix, received_slave_matrix, sizeof(slave_matrix)) == 0;
+    }
+};
+
+TEST_F(SplitMatrixPush, ChangeArrivesWithoutPolling) {
+    for (int i = 0; i < 20; i++) {
+        slave_matrix[i % ROWS_PER_HAND] ^= 1 << (i % MATRIX_COLS);
+        ASSERT_TRUE(scan(1000));
+        EXPECT_TRUE(slave_matrix_received()) << "change " << i;
+    }
+
+    const split_link_sim_stats_t *stats = split_link_sim_get_stats();
+    EXPECT_EQ(stats->transactions, 0u);
+    EXPECT_EQ(stats->failures, 0u);
+    EXPECT_GT(stats->pushes, 0u);
+}
+
+TEST_F(SplitMatrixPush, LostFinalChangeIsRepairedOnTheNextScan) {
+    // A release with nothing after it, which no later change reveals as missing
+    slave_matrix[1] = 0x10;
+    ASSERT_TRUE(scan(1000));
+    ASSERT_TRUE(slave_matrix_received());
+    ASSERT_TRUE(scan(1000));
+
+    slave_matrix[1] = 0;
+    split_link_sim_drop_pushes(1);
+    ASSERT_TRUE(scan(1000));
+    EXPECT_FALSE(slave_matrix_received());
+
+    // The whole matrix follows on the first quiet scan
+    ASSERT_TRUE(scan(1000));
+    EXPECT_TRUE(slave_matrix_received());
+    EXPECT_EQ(split_link_sim_get_stats()->transactions, 0u);
+
+    // And is only sent once
+    uint32_t pushes = split_link_sim_get_stats()->pushes;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(scan(1000));
+    }
+    EXPECT_EQ(split_link_sim_get_stats()->pushes, pushes);
+}
+
+TEST_F(SplitMatrixPush, MissedFrameBeforeALaterChangeIsPolled) {
+    slave_matrix[0] = 0x01;
+    split_link_sim_drop_pushes(1);
+    target_scan();
+    split_link_sim_advance_us(1000);
+
+    // Only carries row 2, but its sequence number gives the loss away
+    slave_matrix[2] = 0x04;
+    ASSERT_TRUE(scan(1000));
+    EXPECT_TRUE(slave_matrix_received());
+    EXPECT_GT(split_link_sim_get_stats()->transactions, 0u);
+}
+
+TEST_F(SplitMatrixPush, LosingBothFramesFallsBackToThePoll) {
+    slave_matrix[3] = 0x80;
+    split_link_sim_drop_pushes(2);
+
+    uint64_t changed_us = split_link_sim_now_us();
+    int      scans      = 0;
+    do {
+        ASSERT_TRUE(scan(1000));
+        ASSERT_LT(++scans, 2 * SPLIT_MATRIX_PUSH_POLL_INTERVAL_US / 1000);
+    } while (!slave_matrix_received());
+
+    EXPECT_LE(split_link_sim_now_us() - changed_us, SPLIT_MATRIX_PUSH_POLL_INTERVAL_US + 2000);
+}
+
+TEST_F(SplitMatrixPush, SurvivesBitErrors) {
+    config.bit_error_ppm = 2000;
+    split_link_sim_configure(&config);
+
+    for (int i = 0; i < 500; i++) {
+        slave_matrix[i % ROWS_PER_HAND] ^= 1 << ((i * 5) % MATRIX_COLS);
+
+        int scans = 0;
+        do {
+            scan(1000);
+            ASSERT_LT(++scans, 250) << "slave matrix not received after change " << i;
+        } while (!slave_matrix_received());
+    }
+
+    const split_link_sim_stats_t *stats = split_link_sim_get_stats();
+    RecordProperty("corrupted_bytes", (int)stats->corrupted_bytes);
+    RecordProperty("failed_transactions", (int)stats->failures);
+    EXPECT_GT(stats->corrupted_bytes, 0u);
+    EXPECT_TRUE(is_transport_connected());
+}
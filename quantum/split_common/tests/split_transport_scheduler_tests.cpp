@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The transaction ids are checked in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "split_link_sim.h"
+#include "split_util.h"
+#include "transport.h"
+
+extern uint32_t mock_matrix_activity_time;
+extern uint32_t mock_slave_matrix_activity_time;
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+// Default of transactions.c
+#define FORCED_SYNC_THROTTLE_MS 100
+
+class SplitTransactionScheduler : public ::testing::Test {
+   protected:
+    split_link_sim_config_t config = SPLIT_LINK_SIM_DEFAULT_CONFIG;
+
+    matrix_row_t master_matrix[ROWS_PER_HAND]          = {}; // keys of the master half
+    matrix_row_t slave_matrix[ROWS_PER_HAND]           = {}; // keys of the slave half
+    matrix_row_t mirrored_master_matrix[ROWS_PER_HAND] = {}; // master keys as seen by the slave
+    matrix_row_t received_slave_matrix[ROWS_PER_HAND]  = {}; // slave keys as seen by the master
+
+    void SetUp() override {
+        split_link_sim_init(&config);
+        // The connection state of split_util.c outlives a test
+        for (int i = 0; i < 1000 && !is_transport_connected(); i++) {
+            scan(1000);
+        }
+        ASSERT_TRUE(is_transport_connected());
+        split_link_sim_clear_stats();
+    }
+
+    // Both halves scan once, then period_us pass until the next scan
+    bool scan(uint32_t period_us) {
+        split_link_sim_target_task(mirrored_master_matrix, slave_matrix);
+        bool okay = transport_master_if_connected(master_matrix, received_slave_matrix);
+        split_link_sim_advance_us(period_us);
+        return okay;
+    }
+
+    uint32_t sent(enum serial_transaction_id id) {
+        return split_link_sim_get_stats()->transactions_by_id[id];
+    }
+};
+
+TEST_F(SplitTransactionScheduler, EnabledMembersShareTheBudget) {
+    // Each sync takes longer than the budget, so a single member runs per scan
+    config.baudrate = 9600;
+    split_link_sim_configure(&config);
+
+    const int scans = 100;
+    for (int i = 0; i < scans; i++) {
+        mock_matrix_activity_time++;
+        ASSERT_TRUE(scan(1000));
+    }
+
+    // Two members are enabled, the one with changes on every scan gets every other turn
+    EXPECT_GE(sent(PUT_ACTIVITY), (uint32_t)scans / 2);
+    EXPECT_GT(sent(PUT_SYNC_TIMER), 0u);
+    EXPECT_EQ(mock_slave_matrix_activity_time, mock_matrix_activity_time - 1);
+}
+
+TEST_F(SplitTransactionScheduler, ChangeReachesTheNextSlaveScan) {
+    for (int i = 0; i < 20; i++) {
+        mock_matrix_activity_time += 7;
+        ASSERT_TRUE(scan(1000));
+        split_link_sim_target_task(mirrored_master_matrix, slave_matrix);
+        EXPECT_EQ(mock_slave_matrix_activity_time, mock_matrix_activity_time) << "change " << i;
+    }
+}
+
+TEST_F(SplitTransactionScheduler, MembersForceSyncsAtTheirOwnThrottle) {
+    for (uint32_t ms = 0; ms < FORCED_SYNC_THROTTLE_MS; ms++) {
+        ASSERT_TRUE(scan(1000));
+    }
+    split_link_sim_clear_stats();
+
+    // Scans take a little longer than their period, count in emulated time
+    uint64_t start_us = split_link_sim_now_us();
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(scan(1000));
+    }
+    uint32_t elapsed_ms = (split_link_sim_now_us() - start_us) / 1000;
+
+    // Nothing changed, so only the forced syncs are left
+    EXPECT_NEAR(sent(PUT_ACTIVITY), elapsed_ms / SPLIT_ACTIVITY_THROTTLE_MS, 1);
+    EXPECT_NEAR(sent(PUT_SYNC_TIMER), elapsed_ms / FORCED_SYNC_THROTTLE_MS, 1);
+}
@@ -0,0 +1,226 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include "gtest/gtest.h"
+
+// The LED matrix headers check their types in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "split_link_sim.h"
+#include "split_util.h"
+#include "transport.h"
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+// Defaults of split_util.c
+#define MAX_CONNECTION_ERRORS 10
+#define CONNECTION_CHECK_TIMEOUT_US (500 * 1000)
+
+class SplitTransport : public ::testing::Test {
+   protected:
+    split_link_sim_config_t config = SPLIT_LINK_SIM_DEFAULT_CONFIG;
+
+    matrix_row_t master_matrix[ROWS_PER_HAND]        = {}; // keys of the master half
+    matrix_row_t slave_matrix[ROWS_PER_HAND]         = {}; // keys of the slave half
+    matrix_row_t mirrored_master_matrix[ROWS_PER_HAND] = {}; // master keys as seen by the slave
+    matrix_row_t received_slave_matrix[ROWS_PER_HAND]  = {}; // slave keys as seen by the master
+
+    void SetUp() override {
+        split_link_sim_init(&config);
+        // The connection state of split_util.c outlives a test
+        for (int i = 0; i < 1000 && !is_transport_connected(); i++) {
+            scan(1000);
+        }
+        ASSERT_TRUE(is_transport_connected());
+        split_link_sim_clear_stats();
+    }
+
+    void target_scan(void) {
+        split_link_sim_target_task(mirrored_master_matrix, slave_matrix);
+    }
+
+    bool master_scan(void) {
+        return transport_master_if_connected(master_matrix, received_slave_matrix);
+    }
+
+    // Both halves scan once, then period_us pass until the next scan
+    bool scan(uint32_t period_us) {
+        target_scan();
+        bool okay = master_scan();
+        split_link_sim_advance_us(period_us);
+        return okay;
+    }
+
+    bool slave_matrix_received(void) {
+        return memcmp(slave_matrix, received_slave_matrix, sizeof(slave_matrix)) == 0;
+    }
+};
+
+TEST_F(SplitTransport, ThroughputScalesWithBaudrate) {
+    const uint32_t baudrates[] = {230400, 921600, 3000000};
+    double         previous    = 0;
+
+    for (uint32_t baudrate : baudrates) {
+        config.baudrate = baudrate;
+        split_link_sim_configure(&config);
+        split_link_sim_clear_stats();
+
+        for (int i = 0; i < 1000; i++) {
+            slave_matrix[i % ROWS_PER_HAND] ^= 1 << (i % MATRIX_COLS);
+            master_matrix[i % ROWS_PER_HAND] ^= 1 << ((i + 3) % MATRIX_COLS);
+            ASSERT_TRUE(scan(0));
+            ASSERT_TRUE(slave_matrix_received());
+        }
+
+        // The slave picks up the last master matrix with its next scan, a
+        // bundle carries what was staged during the previous master scan
+#ifdef SPLIT_TRANSACTION_BUNDLE
+        ASSERT_TRUE(scan(0));
+#endif // SPLIT_TRANSACTION_BUNDLE
+        target_scan();
+
+        const split_link_sim_stats_t *stats       = split_link_sim_get_stats();
+        double                        per_second  = stats->transactions * 1e6 / stats->busy_us;
+        std::string                   key         = std::to_string(baudrate) + "_baud_";
+        RecordProperty(key + "transactions_per_second", (int)per_second);
+        // Over 1000 scans
+        RecordProperty(key + "ns_per_scan", (int)stats->busy_us);
+
+        EXPECT_EQ(stats->failures, 0u);
+        EXPECT_EQ(stats->stray_bytes, 0u);
+        EXPECT_EQ(memcmp(master_matrix, mirrored_master_matrix, sizeof(master_matrix)), 0);
+        EXPECT_GT(per_second, previous);
+        previous = per_second;
+    }
+}
+
+TEST_F(SplitTransport, SlaveKeyLatencyIsBelowTwoScans) {
+    const uint32_t period_us = 1000;
+    uint64_t       total_us  = 0;
+    uint64_t       worst_us  = 0;
+    const int      presses   = 200;
+
+    for (int i = 0; i < presses; i++) {
+        // Keys change anywhere between two scans
+        uint32_t phase_us = (i * 37) % period_us;
+        split_link_sim_advance_us(phase_us);
+        slave_matrix[i % ROWS_PER_HAND] ^= 1 << (i % MATRIX_COLS);
+        uint64_t changed_us = split_link_sim_now_us();
+        split_link_sim_advance_us(period_us - phase_us);
+
+        int scans = 0;
+        while (true) {
+            target_scan();
+            ASSERT_TRUE(master_scan());
+            if (slave_matrix_received()) {
+                break;
+            }
+            ASSERT_LT(++scans, 10);
+            split_link_sim_advance_us(period_us);
+        }
+
+        uint64_t latency_us = split_link_sim_now_us() - changed_us;
+        total_us += latency_us;
+        worst_us = std::max(worst_us, latency_us);
+    }
+
+    RecordProperty("mean_latency_us", (int)(total_us / presses));
+    RecordProperty("worst_latency_us", (int)worst_us);
+    EXPECT_LE(worst_us, 2 * period_us);
+}
+
+TEST_F(SplitTransport, RecoversAfterDisconnect) {
+    const uint32_t period_us = 1000;
+
+    split_link_sim_set_connected(false);
+    uint64_t unplugged_us = split_link_sim_now_us();
+    for (int i = 0; i < 1000 && is_transport_connected(); i++) {
+        scan(period_us);
+    }
+    ASSERT_FALSE(is_transport_connected());
+    uint64_t detected_us = split_link_sim_now_us() - unplugged_us;
+
+    // While unplugged the master only tries every so often, so the scan rate holds up
+    split_link_sim_clear_stats();
+    for (int i = 0; i < 1000; i++) {
+        scan(period_us);
+    }
+    EXPECT_LE(split_link_sim_get_stats()->transactions, 1000u * period_us / CONNECTION_CHECK_TIMEOUT_US + 1);
+
+    slave_matrix[0] = 0x5A;
+    split_link_sim_set_connected(true);
+    uint64_t plugged_us = split_link_sim_now_us();
+    for (int i = 0; i < 1000 && !is_transport_connected(); i++) {
+        scan(period_us);
+    }
+    ASSERT_TRUE(is_transport_connected());
+    uint64_t recovered_us = split_link_sim_now_us() - plugged_us;
+
+    scan(period_us);
+    EXPECT_TRUE(slave_matrix_received());
+
+    RecordProperty("detected_after_us", (int)detected_us);
+    RecordProperty("recovered_after_us", (int)recovered_us);
+    EXPECT_GT(detected_us, (uint64_t)(MAX_CONNECTION_ERRORS - 1) * config.timeout_ms * 1000);
+    EXPECT_LE(recovered_us, CONNECTION_CHECK_TIMEOUT_US + config.timeout_ms * 1000 + 2 * period_us);
+}
+
+TEST_F(SplitTransport, SlaveMatrixSurvivesBitErrors) {
+    const uint32_t period_us = 1000;
+    config.bit_error_ppm     = 2000;
+    split_link_sim_configure(&config);
+
+    for (int i = 0; i < 500; i++) {
+        slave_matrix[i % ROWS_PER_HAND] ^= 1 << ((i * 5) % MATRIX_COLS);
+
+        // A damaged checksum can hide a change until the next forced sync
+        int scans = 0;
+        do {
+            scan(period_us);
+            ASSERT_LT(++scans, 250) << "slave matrix not received after change " << i;
+        } while (!slave_matrix_received());
+    }
+
+    const split_link_sim_stats_t *stats = split_link_sim_get_stats();
+    RecordProperty("corrupted_bytes", (int)stats->corrupted_bytes);
+    RecordProperty("failed_transactions", (int)stats->failures);
+    EXPECT_GT(stats->corrupted_bytes, 0u);
+    EXPECT_TRUE(is_transport_connected());
+}
+
+#ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+
+extern "C" {
+#    include "led_matrix.h"
+
+extern uint8_t mock_slave_leds[LED_MATRIX_LED_COUNT];
+}
+
+TEST_F(SplitTransport, FramebufferReachesSlave) {
+    const uint8_t split[2] = LED_MATRIX_SPLIT;
+    uint8_t      *rendered = &g_led_split_framebuffer[split[0]];
+
+    for (int frame = 0; frame < 200; frame++) {
+        // Mostly a few LEDs per frame, far below the budget, and now and then all of them
+        for (int i = 0; i < split[1]; i++) {
+            if (frame % 50 == 0 || (i + frame) % 7 == 0) {
+                rendered[i] = frame + i;
+            }
+        }
+
+        ASSERT_TRUE(scan(1000)) << "frame " << frame;
+        target_scan();
+        ASSERT_EQ(memcmp(mock_slave_leds, rendered, split[1]), 0) << "frame " << frame;
+    }
+
+    const split_link_sim_stats_t *stats = split_link_sim_get_stats();
+    EXPECT_EQ(stats->failures, 0u);
+    EXPECT_EQ(stats->stray_bytes, 0u);
+}
+
+#endif // LED_MATRIX_SPLIT_FRAMEBUFFER
@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+// The transaction ids are checked in C
+#define _Static_assert static_assert
+
+extern "C" {
+#include "split_link_sim.h"
+#include "split_util.h"
+#include "transport.h"
+#include "matrix.h"
+#include "sync_timer.h"
+
+// Of matrix_common.c
+extern matrix_row_t matrix[MATRIX_ROWS];
+extern uint16_t     matrix_key_time[MATRIX_ROWS][MATRIX_COLS];
+extern uint8_t      thisHand, thatHand;
+}
+
+#define ROWS_PER_HAND (MATRIX_ROWS / 2)
+
+class SplitMatrixScanTimestamps : public ::testing::Test {
+   protected:
+    split_link_sim_config_t config = SPLIT_LINK_SIM_DEFAULT_CONFIG;
+
+    matrix_row_t master_matrix[ROWS_PER_HAND]          = {}; // keys of the master half
+    matrix_row_t slave_matrix[ROWS_PER_HAND]           = {}; // keys of the slave half
+    matrix_row_t mirrored_master_matrix[ROWS_PER_HAND] = {}; // master keys as seen by the slave
+    matrix_row_t received_slave_matrix[ROWS_PER_HAND]  = {}; // slave keys as seen by the master
+
+    void SetUp() override {
+        // Both halves share one matrix_key_time, the slave stamps the rows of
+        // the left hand and the master receives them into the right
+        thisHand = 0;
+        thatHand = ROWS_PER_HAND;
+        memset(matrix, 0, sizeof(matrix));
+        memset(matrix_key_time, 0, sizeof(matrix_key_time));
+
+        split_link_sim_init(&config);
+        // The connection state of split_util.c outlives a test
+        for (int i = 0; i < 1000 && !is_transport_connected(); i++) {
+            scan(1000);
+        }
+        ASSERT_TRUE(is_transport_connected());
+        // Pick up the released matrix after an earlier test
+        ASSERT_TRUE(scan(1000));
+        ASSERT_TRUE(slave_matrix_received());
+        split_link_sim_clear_stats();
+    }
+
+    // Both halves scan once, then period_us pass until the next scan
+    bool scan(uint32_t period_us) {
+        split_link_sim_target_task(mirrored_master_matrix, slave_matrix);
+        bool okay = transport_master_if_connected(master_matrix, received_slave_matrix);
+        split_link_sim_advance_us(period_us);
+        return okay;
+    }
+
+    // The slave's raw matrix changes to raw, returns the time it was stamped with
+    uint16_t slave_raw_scan(const matrix_row_t raw[]) {
+        uint16_t now = sync_timer_read();
+        matrix_key_time_update(slave_matrix, raw);
+        memcpy(slave_matrix, raw, sizeof(slave_matrix));
+        return now;
+    }
+
+    bool slave_matrix_received(void) {
+        return memcmp(slave_matrix, received_slave_matrix, sizeof(slave_matrix)) == 0;
+    }
+
+    uint32_t sent(enum serial_transaction_id id) {
+        return split_link_sim_get_stats()->transactions_by_id[id];
+    }
+};
+
+TEST_F(SplitMatrixScanTimestamps, SlaveEdgeTimesArriveWithItsMatrix) {
+    split_link_sim_advance_us(5000);
+    matrix_row_t raw[ROWS_PER_HAND] = {};
+    raw[1]                          = 1 << 3;
+    uint16_t pressed                = slave_raw_scan(raw);
+
+    split_link_sim_advance_us(7000);
+    raw[2]            = 1 << 6;
+    uint16_t pressed2 = slave_raw_scan(raw);
+    ASSERT_NE(pressed, pressed2);
+
+    ASSERT_EQ(matrix_key_time[thatHand + 1][3], 0);
+    ASSERT_TRUE(scan(1000));
+    ASSERT_TRUE(slave_matrix_received());
+    EXPECT_EQ(matrix_key_time[thatHand + 1][3], pressed);
+    EXPECT_EQ(matrix_key_time[thatHand + 2][6], pressed2);
+    EXPECT_EQ(sent(GET_SLAVE_MATRIX_TIME), 1u);
+}
+
+TEST_F(SplitMatrixScanTimestamps, TimesAreOnlyFetchedWithANewMatrix) {
+    for (int i = 0; i < 50; i++) {
+        ASSERT_TRUE(scan(1000));
+    }
+    EXPECT_EQ(sent(GET_SLAVE_MATRIX_TIME), 0u);
+
+    matrix_row_t raw[ROWS_PER_HAND] = {};
+    raw[0]                          = 1;
+    uint16_t pressed                = slave_raw_scan(raw);
+    for (int i = 0; i < 50; i++) {
+        ASSERT_TRUE(scan(1000));
+    }
+    EXPECT_EQ(sent(GET_SLAVE_MATRIX_TIME), 1u);
+    EXPECT_EQ(matrix_key_time[thatHand][0], pressed);
+}
+
+TEST_F(SplitMatrixScanTimestamps, OnlyTheFirstEdgeAwayFromTheDebouncedStateCounts) {
+    matrix_row_t raw[ROWS_PER_HAND] = {};
+    raw[3]                          = 1 << 7;
+    uint16_t pressed                = slave_raw_scan(raw);
+
+    // Later scans while debouncing see no new edge
+    for (int i = 0; i < 5; i++) {
+        split_link_sim_advance_us(1000);
+        slave_raw_scan(raw);
+    }
+    EXPECT_EQ(matrix_key_time[thisHand + 3][7], pressed);
+
+    // The debounced matrix follows, releasing is an edge away from it again
+    matrix[thisHand + 3] = raw[3];
+    raw[3]               = 0;
+    split_link_sim_advance_us(1000);
+    uint16_t released = slave_raw_scan(raw);
+    EXPECT_NE(released, pressed);
+    EXPECT_EQ(matrix_key_time[thisHand + 3][7], released);
+
+    // A bounce back to the debounced state leaves the time alone
+    raw[3] = 1 << 7;
+    split_link_sim_advance_us(1000);
+    slave_raw_scan(raw);
+    EXPECT_EQ(matrix_key_time[thisHand + 3][7], released);
+}
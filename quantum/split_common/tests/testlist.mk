@@ -0,0 +1,9 @@
+TEST_LIST += \
+	split_transport \
+	split_transport_bundle \
+	split_transport_push \
+	split_transport_scheduler \
+	split_transport_timestamps \
+	split_transport_framebuffer \
+	split_framebuffer \
+	split_link_stats
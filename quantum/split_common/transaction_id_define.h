@@ -21,8 +21,15 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTION_BUNDLE
+    SPLIT_BUNDLE,
+#endif // SPLIT_TRANSACTION_BUNDLE
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    GET_SLAVE_MATRIX_TIME,
+#endif // MATRIX_SCAN_TIMESTAMPS
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
@@ -60,10 +67,16 @@ enum serial_transaction_id {
 
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
     PUT_LED_MATRIX,
+#    ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+    PUT_LED_MATRIX_FRAMEBUFFER,
+#    endif // LED_MATRIX_SPLIT_FRAMEBUFFER
 #endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     PUT_RGB_MATRIX,
+#    ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+    PUT_RGB_MATRIX_FRAMEBUFFER,
+#    endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -82,6 +95,9 @@ enum serial_transaction_id {
     GET_POINTING_CHECKSUM,
     GET_POINTING_DATA,
     PUT_POINTING_CPI,
+#    ifdef SPLIT_POINTING_POLL_INTERVAL
+    GET_POINTING_SAMPLE,
+#    endif // SPLIT_POINTING_POLL_INTERVAL
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
@@ -117,6 +133,10 @@ enum serial_transaction_id {
     PUT_DETECTED_OS,
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SERIAL_USART_SPEED_NEGOTIATION
+    PUT_SERIAL_SPEED,
+#endif // SERIAL_USART_SPEED_NEGOTIATION
+
     NUM_TOTAL_TRANSACTIONS
 };
 
@@ -29,6 +29,8 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "atomic_util.h"
+#include "split_link_stats.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -80,8 +82,17 @@
     { 0, 0, sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), cb }
 #define trans_target2initiator_initializer(member) trans_target2initiator_initializer_cb(member, NULL)
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
+#define trans_bidirectional_initializer_cb(initiator2target_member, target2initiator_member, cb) \
+    { sizeof_member(split_shared_memory_t, initiator2target_member), offsetof(split_shared_memory_t, initiator2target_member), sizeof_member(split_shared_memory_t, target2initiator_member), offsetof(split_shared_memory_t, target2initiator_member), cb }
+
+#ifdef SPLIT_TRANSACTION_BUNDLE
+// Writes are staged for the next bundle frame, reads of bundled data are served from its last reply
+#    define transport_write(id, data, length) split_bundle_stage(id, data, length)
+#    define transport_read(id, data, length) split_bundle_fetch(id, data, length)
+#else // SPLIT_TRANSACTION_BUNDLE
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#    define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
+#endif // SPLIT_TRANSACTION_BUNDLE
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -89,13 +100,367 @@ void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *i
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+////////////////////////////////////////////////////
+// Bundle
+
+#if defined(SPLIT_TRANSPORT_ASYNC) && !defined(SPLIT_TRANSACTION_BUNDLE)
+#    error "SPLIT_TRANSPORT_ASYNC requires SPLIT_TRANSACTION_BUNDLE"
+#endif
+
+#if defined(SPLIT_TRANSPORT_ASYNC) && defined(SPLIT_MATRIX_PUSH)
+#    error "SPLIT_TRANSPORT_ASYNC already fetches the slave matrix every scan, SPLIT_MATRIX_PUSH is not supported with it"
+#endif
+
+#ifdef SPLIT_TRANSACTION_BUNDLE
+
+/*
+    Instead of one round trip per transaction id, the initiator sends every
+    pending write in a single frame:
+
+        [length][presence bits][member payloads, in id order][crc8]
+
+    where length counts the bytes after itself and the presence header holds
+    one bit per transaction id. The reply is a split_bundle_s2m_t carrying the
+    slave matrix, encoders and pointing state, which the read handlers then
+    consume from shared memory instead of fetching it again.
+*/
+
+#    define SPLIT_BUNDLE_HEADER_SIZE ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+#    define SPLIT_BUNDLE_PAYLOAD_SIZE (SPLIT_BUNDLE_BUFFER_SIZE - SPLIT_BUNDLE_HEADER_SIZE - 2)
+#    define SPLIT_BUNDLE_BIT(id) ((uint32_t)1 << (id))
+
+_Static_assert(SPLIT_BUNDLE_BUFFER_SIZE <= UINT8_MAX, "SPLIT_BUNDLE_BUFFER_SIZE must fit the transaction descriptor");
+_Static_assert(SPLIT_BUNDLE_PAYLOAD_SIZE >= sizeof(uint32_t), "SPLIT_BUNDLE_BUFFER_SIZE too small for any member");
+
+#    ifdef ENCODER_ENABLE
+#        define SPLIT_BUNDLE_ENCODER_REPLIES (SPLIT_BUNDLE_BIT(GET_ENCODERS_CHECKSUM) | SPLIT_BUNDLE_BIT(GET_ENCODERS_DATA))
+#    else // ENCODER_ENABLE
+#        define SPLIT_BUNDLE_ENCODER_REPLIES 0
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#        define SPLIT_BUNDLE_POINTING_REPLIES (SPLIT_BUNDLE_BIT(GET_POINTING_CHECKSUM) | SPLIT_BUNDLE_BIT(GET_POINTING_DATA))
+#    else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#        define SPLIT_BUNDLE_POINTING_REPLIES 0
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+// Reads that are answered by the bundle reply
+#    define SPLIT_BUNDLE_REPLIES (SPLIT_BUNDLE_BIT(GET_SLAVE_MATRIX_CHECKSUM) | SPLIT_BUNDLE_BIT(GET_SLAVE_MATRIX_DATA) | SPLIT_BUNDLE_ENCODER_REPLIES | SPLIT_BUNDLE_POINTING_REPLIES)
+
+// Writes staged since the last successful bundle exchange
+static uint32_t split_bundle_pending = 0;
+
+// Plain writes without a slave callback can ride in a bundle frame, RPC keeps its own transactions
+static bool split_bundle_is_member(int8_t id) {
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (id == SPLIT_BUNDLE || trans->slave_callback || trans->target2initiator_buffer_size > 0) {
+        return false;
+    }
+#    ifdef USE_I2C
+    if (id == I2C_EXECUTE_CALLBACK) {
+        return false;
+    }
+#    endif // USE_I2C
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    if (id >= PUT_RPC_INFO && id <= GET_RPC_RESP_DATA) {
+        return false;
+    }
+#    endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    return trans->initiator2target_buffer_size > 0 && trans->initiator2target_buffer_size <= SPLIT_BUNDLE_PAYLOAD_SIZE;
+}
+
+static bool split_bundle_stage(int8_t id, const void *data, size_t length) {
+    if (!split_bundle_is_member(id)) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    size_t                    len   = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    memcpy(split_trans_initiator2target_buffer(trans), data, len);
+    split_bundle_pending |= SPLIT_BUNDLE_BIT(id);
+    return true;
+}
+
+static bool split_bundle_fetch(int8_t id, void *data, size_t length) {
+    if (!(SPLIT_BUNDLE_REPLIES & SPLIT_BUNDLE_BIT(id))) {
+        return transport_execute_transaction(id, NULL, 0, data, length);
+    }
+
+    // Already refreshed by this scan's bundle exchange
+    if (data) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        size_t                    len   = trans->target2initiator_buffer_size < length ? trans->target2initiator_buffer_size : length;
+        memcpy(data, split_trans_target2initiator_buffer(trans), len);
+    }
+    return true;
+}
+
+static bool split_bundle_reply_valid(const split_bundle_s2m_t *reply) {
+    bool valid = reply->smatrix.checksum == crc8(reply->smatrix.matrix, sizeof(reply->smatrix.matrix));
+#    ifdef ENCODER_ENABLE
+    valid &= reply->encoders.checksum == crc8(reply->encoders.state, sizeof(reply->encoders.state));
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    // Only a slave with the pointing device fills in its report, see pointing_handlers_slave()
+#        if defined(POINTING_DEVICE_LEFT)
+    if (!is_keyboard_left())
+#        elif defined(POINTING_DEVICE_RIGHT)
+    if (is_keyboard_left())
+#        endif
+    {
+        valid &= reply->pointing.sample.checksum == crc8(&reply->pointing.sample.motion, sizeof(reply->pointing.sample.motion));
+    }
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    if (!valid) {
+        SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(SPLIT_BUNDLE);
+    }
+    return valid;
+}
+
+// Moves pending writes into the frame, returns the ids it carries
+static uint32_t split_bundle_build(uint8_t frame[SPLIT_BUNDLE_BUFFER_SIZE]) {
+    uint8_t *payload = &frame[1 + SPLIT_BUNDLE_HEADER_SIZE];
+    uint8_t  length  = 0;
+    uint32_t sent    = 0;
+
+    memset(frame, 0, 1 + SPLIT_BUNDLE_HEADER_SIZE);
+
+#    ifndef DISABLE_SYNC_TIMER
+    // The sync timer compensates for the transfer it rides on, so stamp it as the frame leaves
+    if (split_bundle_pending & SPLIT_BUNDLE_BIT(PUT_SYNC_TIMER)) {
+        split_shmem->sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+    }
+#    endif // DISABLE_SYNC_TIMER
+
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (!(split_bundle_pending & SPLIT_BUNDLE_BIT(id))) {
+            continue;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (length + trans->initiator2target_buffer_size > SPLIT_BUNDLE_PAYLOAD_SIZE) {
+            // Stays pending for the next frame
+            continue;
+        }
+        memcpy(&payload[length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        length += trans->initiator2target_buffer_size;
+        frame[1 + id / 8] |= 1 << (id % 8);
+        sent |= SPLIT_BUNDLE_BIT(id);
+    }
+    frame[0]        = SPLIT_BUNDLE_HEADER_SIZE + length + 1;
+    payload[length] = crc8(&frame[1], SPLIT_BUNDLE_HEADER_SIZE + length);
+
+    // Only the used part of the frame goes over the wire
+    split_transaction_table[SPLIT_BUNDLE].initiator2target_buffer_size = 1 + frame[0];
+
+    // Writes staged again while the frame is under way go out with the next one
+    split_bundle_pending &= ~sent;
+    return sent;
+}
+
+static void split_bundle_apply(const split_bundle_s2m_t *reply) {
+    memcpy(&split_shmem->smatrix, &reply->smatrix, sizeof(reply->smatrix));
+#    ifdef ENCODER_ENABLE
+    memcpy(&split_shmem->encoders, &reply->encoders, sizeof(reply->encoders));
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    // The cpi is written by the initiator, leave it alone
+    split_shmem->pointing.sample = reply->pointing.sample;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+#    ifdef SPLIT_TRANSPORT_ASYNC
+
+/*
+    The bundle exchange runs on its own thread, blocked on the serial driver
+    instead of the main loop. Each scan collects the exchange started by the
+    previous one and kicks off the next once its own synchronous transactions
+    are done with the link, so the slave state used by the scan is one
+    exchange old. Replies are received into a back buffer and only handed to
+    the main loop once complete and valid, nothing holds the shared memory
+    lock while the exchange is on the wire.
+*/
+
+#        if !defined(PROTOCOL_CHIBIOS) || defined(USE_I2C)
+#            error "SPLIT_TRANSPORT_ASYNC requires ChibiOS and a serial split transport"
+#        endif
+
+#        include <ch.h>
+
+#        ifndef SPLIT_TRANSPORT_ASYNC_STACK_SIZE
+#            define SPLIT_TRANSPORT_ASYNC_STACK_SIZE 512
+#        endif
+
+#        ifndef SPLIT_TRANSPORT_ASYNC_PRIORITY
+#            define SPLIT_TRANSPORT_ASYNC_PRIORITY (NORMALPRIO + 1)
+#        endif
+
+// Only touched by the transport thread while an exchange is busy
+static uint8_t split_bundle_async_frame[SPLIT_BUNDLE_BUFFER_SIZE];
+// The main loop reads the front reply, the transport thread receives into the other one
+static split_bundle_s2m_t split_bundle_async_replies[2];
+static uint8_t            split_bundle_async_front = 0;
+static bool               split_bundle_async_okay  = false;
+static bool               split_bundle_async_busy  = false;
+static BSEMAPHORE_DECL(split_bundle_async_start, true);
+
+static THD_WORKING_AREA(waSplitTransportThread, SPLIT_TRANSPORT_ASYNC_STACK_SIZE);
+static THD_FUNCTION(SplitTransportThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_transport");
+
+    while (true) {
+        chBSemWait(&split_bundle_async_start);
+        uint8_t             back  = split_bundle_async_front ^ 1;
+        split_bundle_s2m_t *reply = &split_bundle_async_replies[back];
+        bool                okay  = transport_execute_transaction(SPLIT_BUNDLE, split_bundle_async_frame, 1 + split_bundle_async_frame[0], reply, sizeof(*reply)) && split_bundle_reply_valid(reply);
+        // A failed exchange leaves the last valid reply in front
+        if (okay) {
+            split_bundle_async_front = back;
+        }
+        split_bundle_async_okay = okay;
+        // Publish the result before the main loop may look at it
+        __atomic_store_n(&split_bundle_async_busy, false, __ATOMIC_RELEASE);
+    }
+}
+
+// Main loop only, set from starting an exchange until its result was collected
+static bool     split_bundle_async_outstanding = false;
+static uint32_t split_bundle_async_sent        = 0;
+
+static bool bundle_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static bool okay = true;
+
+    if (!split_bundle_async_outstanding || __atomic_load_n(&split_bundle_async_busy, __ATOMIC_ACQUIRE)) {
+        // Carry on with the last completed exchange
+        return okay;
+    }
+
+    okay = split_bundle_async_okay;
+    if (okay) {
+        split_bundle_apply(&split_bundle_async_replies[split_bundle_async_front]);
+    } else {
+        split_bundle_pending |= split_bundle_async_sent;
+    }
+    split_bundle_async_outstanding = false;
+    return okay;
+}
+
+// Starts the next exchange, unless the last one is still under way
+static void split_bundle_async_kick(void) {
+    static thread_t *thread = NULL;
+
+    if (split_bundle_async_outstanding) {
+        return;
+    }
+    if (!thread) {
+        thread = chThdCreateStatic(waSplitTransportThread, sizeof(waSplitTransportThread), SPLIT_TRANSPORT_ASYNC_PRIORITY, SplitTransportThread, NULL);
+    }
+
+    split_bundle_async_sent        = split_bundle_build(split_bundle_async_frame);
+    split_bundle_async_outstanding = true;
+    __atomic_store_n(&split_bundle_async_busy, true, __ATOMIC_RELEASE);
+    chBSemSignal(&split_bundle_async_start);
+}
+
+#    else // SPLIT_TRANSPORT_ASYNC
+
+static bool bundle_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t            frame[SPLIT_BUNDLE_BUFFER_SIZE];
+    split_bundle_s2m_t reply;
+    uint32_t           sent = split_bundle_build(frame);
+
+    if (!transport_execute_transaction(SPLIT_BUNDLE, frame, 1 + frame[0], &reply, sizeof(reply)) || !split_bundle_reply_valid(&reply)) {
+        split_bundle_pending |= sent;
+        return false;
+    }
+
+    split_bundle_apply(&reply);
+    return true;
+}
+
+#    endif // SPLIT_TRANSPORT_ASYNC
+
+static void split_bundle_unpack(void) {
+    uint8_t *frame  = split_shmem->bundle_m2s;
+    uint8_t  length = frame[0];
+
+    // Consume the frame so it is only applied once
+    frame[0] = 0;
+    if (length <= SPLIT_BUNDLE_HEADER_SIZE || length >= sizeof(split_shmem->bundle_m2s) || frame[length] != crc8(&frame[1], length - 1)) {
+        return;
+    }
+
+    const uint8_t *payload   = &frame[1 + SPLIT_BUNDLE_HEADER_SIZE];
+    uint8_t        remaining = length - 1 - SPLIT_BUNDLE_HEADER_SIZE;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (!(frame[1 + id / 8] & (1 << (id % 8)))) {
+            continue;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!split_bundle_is_member(id) || trans->initiator2target_buffer_size > remaining) {
+            return;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), payload, trans->initiator2target_buffer_size);
+        payload += trans->initiator2target_buffer_size;
+        remaining -= trans->initiator2target_buffer_size;
+    }
+}
+
+static void split_bundle_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_bundle_unpack();
+
+    split_bundle_s2m_t *reply = (split_bundle_s2m_t *)target2initiator_buffer;
+    memcpy(&reply->smatrix, &split_shmem->smatrix, sizeof(reply->smatrix));
+#    ifdef ENCODER_ENABLE
+    memcpy(&reply->encoders, &split_shmem->encoders, sizeof(reply->encoders));
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    memcpy(&reply->pointing, &split_shmem->pointing, sizeof(reply->pointing));
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+}
+
+static void bundle_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Transports that run the callback before receiving the frame leave it for the main loop
+    ATOMIC_BLOCK_FORCEON {
+        split_bundle_unpack();
+    }
+}
+
+#    ifdef SPLIT_TRANSPORT_ASYNC
+// A failed exchange is retried by the next scan instead of blocking this one
+#        define TRANSACTIONS_BUNDLE_MASTER()                              \
+            do {                                                          \
+                if (!bundle_handlers_master(master_matrix, slave_matrix)) \
+                    return false;                                         \
+            } while (0)
+#    else // SPLIT_TRANSPORT_ASYNC
+#        define TRANSACTIONS_BUNDLE_MASTER() TRANSACTION_HANDLER_MASTER(bundle)
+#    endif // SPLIT_TRANSPORT_ASYNC
+#    define TRANSACTIONS_BUNDLE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(bundle)
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS [SPLIT_BUNDLE] = trans_bidirectional_initializer_cb(bundle_m2s, bundle_s2m, split_bundle_slave_callback),
+
+#else // SPLIT_TRANSACTION_BUNDLE
+
+#    define TRANSACTIONS_BUNDLE_MASTER()
+#    define TRANSACTIONS_BUNDLE_SLAVE()
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTION_BUNDLE
+
 ////////////////////////////////////////////////////
 // Helpers
 
+#ifdef SPLIT_TRANSACTION_SCHEDULER
+// Forced sync interval of the member being run, set by the scheduler
+static uint16_t split_sync_throttle_ms = FORCED_SYNC_THROTTLE_MS;
+#    define SYNC_THROTTLE_MS split_sync_throttle_ms
+#else // SPLIT_TRANSACTION_SCHEDULER
+#    define SYNC_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#endif // SPLIT_TRANSACTION_SCHEDULER
+
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
     int num_retries = is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+            SPLIT_LINK_STATS_RECORD_RETRY(false);
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -104,6 +469,7 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         this_okay      = handler(master_matrix, slave_matrix);
         if (this_okay) return true;
     }
+    SPLIT_LINK_STATS_RECORD_RETRY(true);
     dprintf("Failed to execute %s\n", prefix);
     return false;
 }
@@ -139,24 +505,45 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
-inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+// State of a checksummed read whose data stays in shared memory
+typedef struct {
+    uint32_t last_update;
+    uint8_t  checksum; // of the data in shared memory when it was last verified
+    bool     verified; // cleared while the data in shared memory may be damaged
+} split_checked_read_t;
+
+/**
+ * @brief Fetches the data of trans_id_retrieve into shared memory if its
+ * checksum changed or a forced sync is due. Returns true if shared memory then
+ * holds verified data, which the caller reads in place. The checksum of the
+ * data is only computed once per fetch, not on every scan.
+ */
+inline static bool read_in_place_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, split_checked_read_t *state, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
-    bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
-        okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
-        if (okay) {
-            *last_update = timer_read32();
-        }
-    } else {
-        memcpy(destination, equiv_shmem, length);
+    if (!transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum))) {
+        return false;
     }
-    return okay;
+    if (state->verified && curr_checksum == state->checksum && timer_elapsed32(state->last_update) < SYNC_THROTTLE_MS) {
+        return true;
+    }
+
+    state->verified = false;
+    if (!transport_read(trans_id_retrieve, NULL, length)) {
+        return false;
+    }
+    if (curr_checksum != crc8(equiv_shmem, length)) {
+        SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(trans_id_retrieve);
+        return false;
+    }
+    state->checksum    = curr_checksum;
+    state->verified    = true;
+    state->last_update = timer_read32();
+    return true;
 }
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (timer_elapsed32(*last_update) >= SYNC_THROTTLE_MS || condition) {
         okay &= transport_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
@@ -173,15 +560,132 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+extern uint16_t matrix_key_time[MATRIX_ROWS][MATRIX_COLS];
+extern uint8_t  thisHand, thatHand;
+
+_Static_assert(sizeof_member(split_shared_memory_t, smatrix_time) <= UINT8_MAX, "MATRIX_ROWS * MATRIX_COLS too large for the slave matrix times to fit the transaction descriptor");
+#endif // MATRIX_SCAN_TIMESTAMPS
+
+static split_checked_read_t slave_matrix_read = {0};
+
+#ifdef SPLIT_MATRIX_PUSH
+
+#    ifndef SPLIT_MATRIX_PUSH_POLL_INTERVAL
+#        define SPLIT_MATRIX_PUSH_POLL_INTERVAL FORCED_SYNC_THROTTLE_MS
+#    endif // SPLIT_MATRIX_PUSH_POLL_INTERVAL
+
+#    define SPLIT_PUSH_ROW_BITS_SIZE ((((MATRIX_ROWS) / 2) + 7) / 8)
+
+// Set whenever a pushed frame was missed, until the next successful poll
+static bool    slave_matrix_push_stale    = true;
+static uint8_t slave_matrix_push_sequence = 0;
+
+void transaction_push_received(const uint8_t *payload, uint8_t size) {
+    if (size < 2 + SPLIT_PUSH_ROW_BITS_SIZE || payload[size - 1] != crc8(payload, size - 1)) {
+        slave_matrix_push_stale = true;
+        return;
+    }
+
+    // Rows are sent whole, so a frame can be applied even if an earlier one went missing
+    if (payload[0] != (uint8_t)(slave_matrix_push_sequence + 1)) {
+        slave_matrix_push_stale = true;
+    }
+    slave_matrix_push_sequence = payload[0];
+
+    const uint8_t *row_bits = &payload[1];
+    const uint8_t *rows     = &payload[1 + SPLIT_PUSH_ROW_BITS_SIZE];
+    const uint8_t *end      = &payload[size - 1];
+    bool           complete = true;
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        if (!(row_bits[row / 8] & (1 << (row % 8)))) {
+            complete = false;
+            continue;
+        }
+        if (rows + sizeof(matrix_row_t) > end) {
+            slave_matrix_push_stale = true;
+            return;
+        }
+        memcpy(&split_shmem->smatrix.matrix[row], rows, sizeof(matrix_row_t));
+        rows += sizeof(matrix_row_t);
+        // No longer the data the last poll verified
+        slave_matrix_read.verified = false;
+    }
+
+    // The whole matrix replaces whatever frames went missing before it
+    if (complete) {
+        slave_matrix_push_stale = false;
+    }
+}
+
+static void slave_matrix_push(matrix_row_t slave_matrix[]) {
+    static matrix_row_t pushed[(MATRIX_ROWS) / 2]    = {0};
+    static uint8_t      sequence                     = 0;
+    static bool         repeat                       = false; // set after pushing changes, until the whole matrix followed them
+    uint8_t             payload[SPLIT_PUSH_MAX_SIZE] = {0};
+    uint8_t             size                         = 1 + SPLIT_PUSH_ROW_BITS_SIZE;
+    bool                complete                     = false;
+
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        if (slave_matrix[row] != pushed[row]) {
+            payload[1 + row / 8] |= 1 << (row % 8);
+            memcpy(&payload[size], &slave_matrix[row], sizeof(matrix_row_t));
+            size += sizeof(matrix_row_t);
+        }
+    }
+    if (size == 1 + SPLIT_PUSH_ROW_BITS_SIZE) {
+        if (!repeat) {
+            return;
+        }
+        // Nothing follows the last change to reveal it went missing, so send the whole matrix on the first quiet scan
+        for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+            payload[1 + row / 8] |= 1 << (row % 8);
+            memcpy(&payload[size], &slave_matrix[row], sizeof(matrix_row_t));
+            size += sizeof(matrix_row_t);
+        }
+        complete = true;
+    }
+
+    payload[0]    = sequence + 1;
+    payload[size] = crc8(payload, size);
+    // Retried on the next scan if the link was busy
+    if (transport_push(payload, size + 1)) {
+        sequence++;
+        memcpy(pushed, slave_matrix, sizeof(pushed));
+        repeat = !complete;
+    }
+}
+
+#endif // SPLIT_MATRIX_PUSH
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef SPLIT_MATRIX_PUSH
+    static uint32_t last_poll = 0;
+    bool            okay      = true;
+
+    // Pushed changes are already in shared memory, only poll to check the slave is still there
+    transport_receive_pushes();
+    if (slave_matrix_push_stale || timer_elapsed32(last_poll) >= SPLIT_MATRIX_PUSH_POLL_INTERVAL) {
+        okay = read_in_place_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &slave_matrix_read, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+        if (okay) {
+            slave_matrix_push_stale = false;
+            last_poll               = timer_read32();
+        }
+    }
+#else  // SPLIT_MATRIX_PUSH
+    bool okay = read_in_place_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &slave_matrix_read, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#endif // SPLIT_MATRIX_PUSH
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    // The edge times are only needed for keys that are about to change, fetch them alongside a new matrix
+    if (okay && memcmp(last_matrix, split_shmem->smatrix.matrix, sizeof(last_matrix)) != 0) {
+        okay = transport_read(GET_SLAVE_MATRIX_TIME, matrix_key_time[thatHand], sizeof(split_shmem->smatrix_time));
+    }
+#endif // MATRIX_SCAN_TIMESTAMPS
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        memcpy(last_matrix, split_shmem->smatrix.matrix, sizeof(last_matrix));
     }
     // Copy out the last-known-good matrix state to the slave matrix
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
@@ -189,16 +693,33 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
-    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    split_shmem->smatrix.checksum = crc8_copy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    memcpy(split_shmem->smatrix_time, matrix_key_time[thisHand], sizeof(split_shmem->smatrix_time));
+#endif // MATRIX_SCAN_TIMESTAMPS
 }
 
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#ifdef SPLIT_MATRIX_PUSH
+// The push takes the shared memory lock itself
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE()                 \
+        do {                                                  \
+            TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix); \
+            slave_matrix_push(slave_matrix);                  \
+        } while (0)
+#else // SPLIT_MATRIX_PUSH
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#endif // SPLIT_MATRIX_PUSH
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    TRANSACTIONS_SLAVE_MATRIX_TIME_REGISTRATIONS
+#ifdef MATRIX_SCAN_TIMESTAMPS
+#    define TRANSACTIONS_SLAVE_MATRIX_TIME_REGISTRATIONS [GET_SLAVE_MATRIX_TIME] = trans_target2initiator_initializer(smatrix_time),
+#else // MATRIX_SCAN_TIMESTAMPS
+#    define TRANSACTIONS_SLAVE_MATRIX_TIME_REGISTRATIONS
+#endif // MATRIX_SCAN_TIMESTAMPS
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -234,21 +755,18 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #ifdef ENCODER_ENABLE
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         temp_state[NUM_ENCODERS_MAX_PER_SIDE];
+    static split_checked_read_t state_read = {0};
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, temp_state, split_shmem->encoders.state, sizeof(temp_state));
-    if (okay) encoder_update_raw(temp_state);
+    bool okay = read_in_place_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &state_read, split_shmem->encoders.state, sizeof(split_shmem->encoders.state));
+    if (okay) encoder_update_raw(split_shmem->encoders.state);
     return okay;
 }
 
 static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    uint8_t encoder_state[NUM_ENCODERS_MAX_PER_SIDE];
-    encoder_state_raw(encoder_state);
     // Always prepare the encoder state for read.
-    memcpy(split_shmem->encoders.state, encoder_state, sizeof(encoder_state));
+    encoder_state_raw(split_shmem->encoders.state);
     // Now update the checksum given that the encoders has been written to
-    split_shmem->encoders.checksum = crc8(encoder_state, sizeof(encoder_state));
+    split_shmem->encoders.checksum = crc8(split_shmem->encoders.state, sizeof(split_shmem->encoders.state));
 }
 
 // clang-format off
@@ -276,7 +794,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     static uint32_t last_update = 0;
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+    if (timer_elapsed32(last_update) >= SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
         okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
@@ -297,12 +815,14 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_SYNC_TIMER_MASTER() TRANSACTION_HANDLER_MASTER(sync_timer)
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(sync_timer)
 #    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS [PUT_SYNC_TIMER] = trans_initiator2target_initializer(sync_timer),
+#    define TRANSACTIONS_SYNC_TIMER_SCHEDULE TRANSACTION_SCHEDULE(sync_timer, SPLIT_SYNC_TIMER_THROTTLE_MS)
 
 #else // DISABLE_SYNC_TIMER
 
 #    define TRANSACTIONS_SYNC_TIMER_MASTER()
 #    define TRANSACTIONS_SYNC_TIMER_SLAVE()
 #    define TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
+#    define TRANSACTIONS_SYNC_TIMER_SCHEDULE
 
 #endif // DISABLE_SYNC_TIMER
 
@@ -322,6 +842,8 @@ static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row
     return okay;
 }
 
+// Sent by the master and not checksummed, unlike the slave data fetched with
+// read_in_place_if_checksum_mismatch(). The slave already reads it in place.
 static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     layer_state         = split_shmem->layers.layer_state;
     default_layer_state = split_shmem->layers.default_layer_state;
@@ -333,6 +855,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS \
     [PUT_LAYER_STATE]         = trans_initiator2target_initializer(layers.layer_state), \
     [PUT_DEFAULT_LAYER_STATE] = trans_initiator2target_initializer(layers.default_layer_state),
+#    define TRANSACTIONS_LAYER_STATE_SCHEDULE TRANSACTION_SCHEDULE(layer_state, SPLIT_LAYER_STATE_THROTTLE_MS)
 // clang-format on
 
 #else // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
@@ -340,6 +863,7 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_LAYER_STATE_MASTER()
 #    define TRANSACTIONS_LAYER_STATE_SLAVE()
 #    define TRANSACTIONS_LAYER_STATE_REGISTRATIONS
+#    define TRANSACTIONS_LAYER_STATE_SCHEDULE
 
 #endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
@@ -362,12 +886,14 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_LED_STATE_MASTER() TRANSACTION_HANDLER_MASTER(led_state)
 #    define TRANSACTIONS_LED_STATE_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(led_state)
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS [PUT_LED_STATE] = trans_initiator2target_initializer(led_state),
+#    define TRANSACTIONS_LED_STATE_SCHEDULE TRANSACTION_SCHEDULE(led_state, SPLIT_LED_STATE_THROTTLE_MS)
 
 #else // SPLIT_LED_STATE_ENABLE
 
 #    define TRANSACTIONS_LED_STATE_MASTER()
 #    define TRANSACTIONS_LED_STATE_SLAVE()
 #    define TRANSACTIONS_LED_STATE_REGISTRATIONS
+#    define TRANSACTIONS_LED_STATE_SCHEDULE
 
 #endif // SPLIT_LED_STATE_ENABLE
 
@@ -378,7 +904,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = timer_elapsed32(last_update) >= SYNC_THROTTLE_MS;
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -408,6 +934,8 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
     return okay;
 }
 
+// Sent by the master and not checksummed, so read_in_place_if_checksum_mismatch()
+// does not apply. The copy only keeps the lock out of the set_*_mods() calls.
 static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     split_shared_memory_lock();
     split_mods_sync_t mods;
@@ -424,12 +952,14 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_MODS_MASTER() TRANSACTION_HANDLER_MASTER(mods)
 #    define TRANSACTIONS_MODS_SLAVE() TRANSACTION_HANDLER_SLAVE(mods)
 #    define TRANSACTIONS_MODS_REGISTRATIONS [PUT_MODS] = trans_initiator2target_initializer(mods),
+#    define TRANSACTIONS_MODS_SCHEDULE TRANSACTION_SCHEDULE(mods, SPLIT_MODS_THROTTLE_MS)
 
 #else // SPLIT_MODS_ENABLE
 
 #    define TRANSACTIONS_MODS_MASTER()
 #    define TRANSACTIONS_MODS_SLAVE()
 #    define TRANSACTIONS_MODS_REGISTRATIONS
+#    define TRANSACTIONS_MODS_SCHEDULE
 
 #endif // SPLIT_MODS_ENABLE
 
@@ -455,12 +985,14 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #    define TRANSACTIONS_BACKLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(backlight)
 #    define TRANSACTIONS_BACKLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(backlight)
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS [PUT_BACKLIGHT] = trans_initiator2target_initializer(backlight_level),
+#    define TRANSACTIONS_BACKLIGHT_SCHEDULE TRANSACTION_SCHEDULE(backlight, SPLIT_BACKLIGHT_THROTTLE_MS)
 
 #else // BACKLIGHT_ENABLE
 
 #    define TRANSACTIONS_BACKLIGHT_MASTER()
 #    define TRANSACTIONS_BACKLIGHT_SLAVE()
 #    define TRANSACTIONS_BACKLIGHT_REGISTRATIONS
+#    define TRANSACTIONS_BACKLIGHT_SCHEDULE
 
 #endif // BACKLIGHT_ENABLE
 
@@ -483,13 +1015,16 @@ static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t
 
 static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     split_shared_memory_lock();
-    // Update the RGB with the new data
+    // Update the RGB with the new data, nothing to copy out while it is unchanged
     rgblight_syncinfo_t rgblight_sync;
-    memcpy(&rgblight_sync, &split_shmem->rgblight_sync, sizeof(rgblight_syncinfo_t));
-    split_shmem->rgblight_sync.status.change_flags = 0;
+    bool                changed = split_shmem->rgblight_sync.status.change_flags != 0;
+    if (changed) {
+        memcpy(&rgblight_sync, &split_shmem->rgblight_sync, sizeof(rgblight_syncinfo_t));
+        split_shmem->rgblight_sync.status.change_flags = 0;
+    }
     split_shared_memory_unlock();
 
-    if (rgblight_sync.status.change_flags != 0) {
+    if (changed) {
         rgblight_update_sync(&rgblight_sync, false);
     }
 }
@@ -497,12 +1032,14 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_RGBLIGHT_MASTER() TRANSACTION_HANDLER_MASTER(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_SLAVE() TRANSACTION_HANDLER_SLAVE(rgblight)
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS [PUT_RGBLIGHT] = trans_initiator2target_initializer(rgblight_sync),
+#    define TRANSACTIONS_RGBLIGHT_SCHEDULE TRANSACTION_SCHEDULE(rgblight, SPLIT_RGBLIGHT_THROTTLE_MS)
 
 #else // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 #    define TRANSACTIONS_RGBLIGHT_MASTER()
 #    define TRANSACTIONS_RGBLIGHT_SLAVE()
 #    define TRANSACTIONS_RGBLIGHT_REGISTRATIONS
+#    define TRANSACTIONS_RGBLIGHT_SCHEDULE
 
 #endif // defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
@@ -528,15 +1065,97 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     led_matrix_set_suspend_state(led_suspend_state);
 }
 
-#    define TRANSACTIONS_LED_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix)
-#    define TRANSACTIONS_LED_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix)
-#    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync),
+#    ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+
+static const uint8_t led_matrix_split_leds[2] = LED_MATRIX_SPLIT;
+// Set by the slave callback, consumed by the slave handler on the main loop
+static bool led_matrix_framebuffer_dirty = false;
+
+static bool led_matrix_framebuffer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t             sent[LED_MATRIX_LED_COUNT];
+    static split_framebuffer_t framebuffer = {.pixel_size = 1};
+    static bool                flush       = false;
+
+    bool    slave_is_left = !is_keyboard_left();
+    uint8_t first         = split_framebuffer_slave_first(led_matrix_split_leds, slave_is_left);
+    framebuffer.pixels    = &g_led_split_framebuffer[first];
+    framebuffer.sent      = &sent[first];
+    framebuffer.count     = split_framebuffer_slave_count(led_matrix_split_leds, slave_is_left);
+
+    uint8_t frame[1 + SPLIT_FRAMEBUFFER_BUDGET];
+    frame[0] = split_framebuffer_encode(&framebuffer, &frame[1], SPLIT_FRAMEBUFFER_BUDGET);
+    // Follow the last changes with an empty frame, for transports that run the slave callback before receiving
+    if (frame[0] == 0 && !flush) {
+        return true;
+    }
+    flush = frame[0] != 0;
+
+    // Only the used part of the frame goes over the wire
+    split_transaction_table[PUT_LED_MATRIX_FRAMEBUFFER].initiator2target_buffer_size = 1 + frame[0];
+    if (!transport_write(PUT_LED_MATRIX_FRAMEBUFFER, frame, 1 + frame[0])) {
+        // The slave may have missed any part of it
+        split_framebuffer_invalidate(&framebuffer);
+        return false;
+    }
+    return true;
+}
+
+static void led_matrix_framebuffer_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t *frame = (uint8_t *)initiator2target_buffer;
+    uint8_t  first = split_framebuffer_slave_first(led_matrix_split_leds, is_keyboard_left());
+    uint8_t  count = split_framebuffer_slave_count(led_matrix_split_leds, is_keyboard_left());
+
+    if (frame[0] < initiator2target_buffer_size && split_framebuffer_decode(&g_led_split_framebuffer[first], 1, count, &frame[1], frame[0])) {
+        led_matrix_framebuffer_dirty = true;
+    }
+    // Consume the frame so it is only applied once
+    frame[0] = 0;
+}
+
+static void led_matrix_framebuffer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t first = split_framebuffer_slave_first(led_matrix_split_leds, is_keyboard_left());
+    uint8_t count = split_framebuffer_slave_count(led_matrix_split_leds, is_keyboard_left());
+
+    split_shared_memory_lock();
+    if (led_matrix_framebuffer_dirty) {
+        // Cleared first, so a frame decoded while copying is copied again next time
+        led_matrix_framebuffer_dirty = false;
+        for (uint8_t i = 0; i < count; i++) {
+            led_matrix_driver.set_value(first + i, g_led_split_framebuffer[first + i]);
+        }
+    }
+    split_shared_memory_unlock();
+}
+
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_MASTER() TRANSACTION_HANDLER_MASTER(led_matrix_framebuffer)
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SLAVE() TRANSACTION_HANDLER_SLAVE(led_matrix_framebuffer)
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_REGISTRATIONS [PUT_LED_MATRIX_FRAMEBUFFER] = trans_initiator2target_initializer_cb(led_matrix_framebuffer, led_matrix_framebuffer_slave_callback),
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SCHEDULE TRANSACTION_SCHEDULE(led_matrix_framebuffer, SPLIT_LED_MATRIX_THROTTLE_MS)
+
+#    else // LED_MATRIX_SPLIT_FRAMEBUFFER
+
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_MASTER()
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SLAVE()
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_REGISTRATIONS
+#        define TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SCHEDULE
+
+#    endif // LED_MATRIX_SPLIT_FRAMEBUFFER
+
+#    define TRANSACTIONS_LED_MATRIX_MASTER()          \
+        TRANSACTION_HANDLER_MASTER(led_matrix); \
+        TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_MASTER()
+#    define TRANSACTIONS_LED_MATRIX_SLAVE()          \
+        TRANSACTION_HANDLER_SLAVE(led_matrix); \
+        TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SLAVE()
+#    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS [PUT_LED_MATRIX] = trans_initiator2target_initializer(led_matrix_sync), TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_REGISTRATIONS
+#    define TRANSACTIONS_LED_MATRIX_SCHEDULE TRANSACTION_SCHEDULE(led_matrix, SPLIT_LED_MATRIX_THROTTLE_MS) TRANSACTIONS_LED_MATRIX_FRAMEBUFFER_SCHEDULE
 
 #else // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 #    define TRANSACTIONS_LED_MATRIX_MASTER()
 #    define TRANSACTIONS_LED_MATRIX_SLAVE()
 #    define TRANSACTIONS_LED_MATRIX_REGISTRATIONS
+#    define TRANSACTIONS_LED_MATRIX_SCHEDULE
 
 #endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
@@ -562,15 +1181,97 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
     rgb_matrix_set_suspend_state(rgb_suspend_state);
 }
 
-#    define TRANSACTIONS_RGB_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix)
-#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync),
+#    ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+
+static const uint8_t rgb_matrix_split_leds[2] = RGB_MATRIX_SPLIT;
+// Set by the slave callback, consumed by the slave handler on the main loop
+static bool rgb_matrix_framebuffer_dirty = false;
+
+static bool rgb_matrix_framebuffer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t             sent[RGB_MATRIX_LED_COUNT * 3];
+    static split_framebuffer_t framebuffer = {.pixel_size = 3};
+    static bool                flush       = false;
+
+    bool    slave_is_left = !is_keyboard_left();
+    uint8_t first         = split_framebuffer_slave_first(rgb_matrix_split_leds, slave_is_left);
+    framebuffer.pixels    = &g_rgb_split_framebuffer[first][0];
+    framebuffer.sent      = &sent[first * 3];
+    framebuffer.count     = split_framebuffer_slave_count(rgb_matrix_split_leds, slave_is_left);
+
+    uint8_t frame[1 + SPLIT_FRAMEBUFFER_BUDGET];
+    frame[0] = split_framebuffer_encode(&framebuffer, &frame[1], SPLIT_FRAMEBUFFER_BUDGET);
+    // Follow the last changes with an empty frame, for transports that run the slave callback before receiving
+    if (frame[0] == 0 && !flush) {
+        return true;
+    }
+    flush = frame[0] != 0;
+
+    // Only the used part of the frame goes over the wire
+    split_transaction_table[PUT_RGB_MATRIX_FRAMEBUFFER].initiator2target_buffer_size = 1 + frame[0];
+    if (!transport_write(PUT_RGB_MATRIX_FRAMEBUFFER, frame, 1 + frame[0])) {
+        // The slave may have missed any part of it
+        split_framebuffer_invalidate(&framebuffer);
+        return false;
+    }
+    return true;
+}
+
+static void rgb_matrix_framebuffer_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t *frame = (uint8_t *)initiator2target_buffer;
+    uint8_t  first = split_framebuffer_slave_first(rgb_matrix_split_leds, is_keyboard_left());
+    uint8_t  count = split_framebuffer_slave_count(rgb_matrix_split_leds, is_keyboard_left());
+
+    if (frame[0] < initiator2target_buffer_size && split_framebuffer_decode(&g_rgb_split_framebuffer[first][0], 3, count, &frame[1], frame[0])) {
+        rgb_matrix_framebuffer_dirty = true;
+    }
+    // Consume the frame so it is only applied once
+    frame[0] = 0;
+}
+
+static void rgb_matrix_framebuffer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t first = split_framebuffer_slave_first(rgb_matrix_split_leds, is_keyboard_left());
+    uint8_t count = split_framebuffer_slave_count(rgb_matrix_split_leds, is_keyboard_left());
+
+    split_shared_memory_lock();
+    if (rgb_matrix_framebuffer_dirty) {
+        // Cleared first, so a frame decoded while copying is copied again next time
+        rgb_matrix_framebuffer_dirty = false;
+        for (uint8_t i = 0; i < count; i++) {
+            rgb_matrix_driver.set_color(first + i, g_rgb_split_framebuffer[first + i][0], g_rgb_split_framebuffer[first + i][1], g_rgb_split_framebuffer[first + i][2]);
+        }
+    }
+    split_shared_memory_unlock();
+}
+
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_MASTER() TRANSACTION_HANDLER_MASTER(rgb_matrix_framebuffer)
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SLAVE() TRANSACTION_HANDLER_SLAVE(rgb_matrix_framebuffer)
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_REGISTRATIONS [PUT_RGB_MATRIX_FRAMEBUFFER] = trans_initiator2target_initializer_cb(rgb_matrix_framebuffer, rgb_matrix_framebuffer_slave_callback),
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SCHEDULE TRANSACTION_SCHEDULE(rgb_matrix_framebuffer, SPLIT_RGB_MATRIX_THROTTLE_MS)
+
+#    else // RGB_MATRIX_SPLIT_FRAMEBUFFER
+
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_MASTER()
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SLAVE()
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_REGISTRATIONS
+#        define TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SCHEDULE
+
+#    endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
+
+#    define TRANSACTIONS_RGB_MATRIX_MASTER()          \
+        TRANSACTION_HANDLER_MASTER(rgb_matrix); \
+        TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_MASTER()
+#    define TRANSACTIONS_RGB_MATRIX_SLAVE()          \
+        TRANSACTION_HANDLER_SLAVE(rgb_matrix); \
+        TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SLAVE()
+#    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS [PUT_RGB_MATRIX] = trans_initiator2target_initializer(rgb_matrix_sync), TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_REGISTRATIONS
+#    define TRANSACTIONS_RGB_MATRIX_SCHEDULE TRANSACTION_SCHEDULE(rgb_matrix, SPLIT_RGB_MATRIX_THROTTLE_MS) TRANSACTIONS_RGB_MATRIX_FRAMEBUFFER_SCHEDULE
 
 #else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #    define TRANSACTIONS_RGB_MATRIX_MASTER()
 #    define TRANSACTIONS_RGB_MATRIX_SLAVE()
 #    define TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
+#    define TRANSACTIONS_RGB_MATRIX_SCHEDULE
 
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
@@ -592,12 +1293,14 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #    define TRANSACTIONS_WPM_MASTER() TRANSACTION_HANDLER_MASTER(wpm)
 #    define TRANSACTIONS_WPM_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(wpm)
 #    define TRANSACTIONS_WPM_REGISTRATIONS [PUT_WPM] = trans_initiator2target_initializer(current_wpm),
+#    define TRANSACTIONS_WPM_SCHEDULE TRANSACTION_SCHEDULE(wpm, SPLIT_WPM_THROTTLE_MS)
 
 #else // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
 #    define TRANSACTIONS_WPM_MASTER()
 #    define TRANSACTIONS_WPM_SLAVE()
 #    define TRANSACTIONS_WPM_REGISTRATIONS
+#    define TRANSACTIONS_WPM_SCHEDULE
 
 #endif // defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
@@ -627,12 +1330,14 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
 #    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
+#    define TRANSACTIONS_OLED_SCHEDULE TRANSACTION_SCHEDULE(oled, SPLIT_OLED_THROTTLE_MS)
 
 #else // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #    define TRANSACTIONS_OLED_MASTER()
 #    define TRANSACTIONS_OLED_SLAVE()
 #    define TRANSACTIONS_OLED_REGISTRATIONS
+#    define TRANSACTIONS_OLED_SCHEDULE
 
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
@@ -662,12 +1367,14 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_ST7565_MASTER() TRANSACTION_HANDLER_MASTER(st7565)
 #    define TRANSACTIONS_ST7565_SLAVE() TRANSACTION_HANDLER_SLAVE(st7565)
 #    define TRANSACTIONS_ST7565_REGISTRATIONS [PUT_ST7565] = trans_initiator2target_initializer(current_st7565_state),
+#    define TRANSACTIONS_ST7565_SCHEDULE TRANSACTION_SCHEDULE(st7565, SPLIT_ST7565_THROTTLE_MS)
 
 #else // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #    define TRANSACTIONS_ST7565_MASTER()
 #    define TRANSACTIONS_ST7565_SLAVE()
 #    define TRANSACTIONS_ST7565_REGISTRATIONS
+#    define TRANSACTIONS_ST7565_SCHEDULE
 
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
@@ -676,22 +1383,44 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
-static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
-    if (is_keyboard_left()) {
-        return true;
-    }
+#        define POINTING_DEVICE_ON_SLAVE() (!is_keyboard_left())
 #    elif defined(POINTING_DEVICE_RIGHT)
-    if (!is_keyboard_left()) {
+#        define POINTING_DEVICE_ON_SLAVE() (is_keyboard_left())
+#    else
+#        define POINTING_DEVICE_ON_SLAVE() true
+#    endif
+
+// Totals of the last motion applied, only meaningful while connected to the same slave
+static split_pointing_motion_t pointing_last_motion;
+static bool                    pointing_last_motion_valid = false;
+
+static void pointing_apply_motion(const split_pointing_motion_t *motion) {
+    if (pointing_last_motion_valid) {
+        // Totals wrap, so their difference is right as long as less than 32767 counts pass between reads
+        pointing_device_add_shared_motion((int16_t)(motion->x - pointing_last_motion.x), (int16_t)(motion->y - pointing_last_motion.y), (int16_t)(motion->h - pointing_last_motion.h), (int16_t)(motion->v - pointing_last_motion.v), motion->buttons);
+    }
+    pointing_last_motion       = *motion;
+    pointing_last_motion_valid = true;
+}
+
+static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    if (!POINTING_DEVICE_ON_SLAVE()) {
         return true;
     }
-#    endif
-    static uint32_t last_update = 0;
-    static uint16_t last_cpi    = 0;
-    report_mouse_t  temp_state;
+    if (!is_transport_connected()) {
+        // The slave may have restarted its totals in the meantime
+        pointing_last_motion_valid = false;
+    }
+
+    bool            okay     = true;
+    static uint16_t last_cpi = 0;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+#    ifndef SPLIT_POINTING_POLL_INTERVAL
+    static split_checked_read_t motion_read = {0};
+    okay = read_in_place_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &motion_read, &split_shmem->pointing.sample.motion, sizeof(split_shmem->pointing.sample.motion));
+    if (okay) pointing_apply_motion(&split_shmem->pointing.sample.motion);
+#    endif // SPLIT_POINTING_POLL_INTERVAL
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi && last_cpi != temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -703,6 +1432,44 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     return okay;
 }
 
+#    ifdef SPLIT_POINTING_POLL_INTERVAL
+
+bool transaction_pointing_poll(void) {
+    static uint32_t last_poll = 0;
+
+    if (!POINTING_DEVICE_ON_SLAVE()) {
+        return false;
+    }
+    if (!is_transport_connected()) {
+        pointing_last_motion_valid = false;
+        return false;
+    }
+    if (timer_elapsed32(last_poll) < SPLIT_POINTING_POLL_INTERVAL) {
+        return false;
+    }
+    last_poll = timer_read32();
+
+    // A single round trip of its own, never bundled and independent of the scan rate
+    split_pointing_sample_t sample;
+    if (!transport_execute_transaction(GET_POINTING_SAMPLE, NULL, 0, &sample, sizeof(sample))) {
+        return false;
+    }
+    if (sample.checksum != crc8(&sample.motion, sizeof(sample.motion))) {
+        SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(GET_POINTING_SAMPLE);
+        return false;
+    }
+    pointing_apply_motion(&sample.motion);
+    return true;
+}
+
+#        define TRANSACTIONS_POINTING_SAMPLE_REGISTRATIONS [GET_POINTING_SAMPLE] = trans_target2initiator_initializer(pointing.sample),
+
+#    else // SPLIT_POINTING_POLL_INTERVAL
+
+#        define TRANSACTIONS_POINTING_SAMPLE_REGISTRATIONS
+
+#    endif // SPLIT_POINTING_POLL_INTERVAL
+
 extern const pointing_device_driver_t pointing_device_driver;
 
 static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -726,26 +1493,31 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     uint16_t temp_cpi = !pointing_device_driver.get_cpi ? 0 : pointing_device_driver.get_cpi(); // check for NULL
 
     split_shared_memory_lock();
-    split_slave_pointing_sync_t pointing;
-    memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
+    uint16_t cpi = split_shmem->pointing.cpi;
     split_shared_memory_unlock();
 
-    if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver.set_cpi) {
-        pointing_device_driver.set_cpi(pointing.cpi);
+    if (cpi && cpi != temp_cpi && pointing_device_driver.set_cpi) {
+        pointing_device_driver.set_cpi(cpi);
     }
 
-    pointing.report = pointing_device_driver.get_report((report_mouse_t){0});
-    // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    report_mouse_t report = pointing_device_driver.get_report((report_mouse_t){0});
 
+    // Add to the totals, however often the master reads them
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    split_pointing_sample_t *sample = &split_shmem->pointing.sample;
+    sample->motion.x                = (int16_t)(sample->motion.x + report.x);
+    sample->motion.y                = (int16_t)(sample->motion.y + report.y);
+    sample->motion.h                = (int16_t)(sample->motion.h + report.h);
+    sample->motion.v                = (int16_t)(sample->motion.v + report.v);
+    sample->motion.buttons          = report.buttons;
+    // Now update the checksum given that the pointing has been written to
+    sample->checksum = crc8(&sample->motion, sizeof(sample->motion));
     split_shared_memory_unlock();
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.sample.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.sample.motion), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi), TRANSACTIONS_POINTING_SAMPLE_REGISTRATIONS
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -776,12 +1548,14 @@ static void watchdog_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_WATCHDOG_MASTER() TRANSACTION_HANDLER_MASTER(watchdog)
 #    define TRANSACTIONS_WATCHDOG_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(watchdog)
 #    define TRANSACTIONS_WATCHDOG_REGISTRATIONS [PUT_WATCHDOG] = trans_initiator2target_initializer(watchdog_pinged),
+#    define TRANSACTIONS_WATCHDOG_SCHEDULE TRANSACTION_SCHEDULE(watchdog, FORCED_SYNC_THROTTLE_MS)
 
 #else // defined(SPLIT_WATCHDOG_ENABLE)
 
 #    define TRANSACTIONS_WATCHDOG_MASTER()
 #    define TRANSACTIONS_WATCHDOG_SLAVE()
 #    define TRANSACTIONS_WATCHDOG_REGISTRATIONS
+#    define TRANSACTIONS_WATCHDOG_SCHEDULE
 
 #endif // defined(SPLIT_WATCHDOG_ENABLE)
 
@@ -817,6 +1591,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_HAPTIC_MASTER() TRANSACTION_HANDLER_MASTER(haptic)
 #    define TRANSACTIONS_HAPTIC_SLAVE() TRANSACTION_HANDLER_SLAVE(haptic)
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS [PUT_HAPTIC] = trans_initiator2target_initializer(haptic_sync),
+#    define TRANSACTIONS_HAPTIC_SCHEDULE TRANSACTION_SCHEDULE(haptic, SPLIT_HAPTIC_THROTTLE_MS)
 // clang-format on
 
 #else // defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
@@ -824,6 +1599,7 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #    define TRANSACTIONS_HAPTIC_MASTER()
 #    define TRANSACTIONS_HAPTIC_SLAVE()
 #    define TRANSACTIONS_HAPTIC_REGISTRATIONS
+#    define TRANSACTIONS_HAPTIC_SCHEDULE
 
 #endif // defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
 
@@ -846,6 +1622,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_ACTIVITY_MASTER() TRANSACTION_HANDLER_MASTER(activity)
 #    define TRANSACTIONS_ACTIVITY_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(activity)
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS [PUT_ACTIVITY] = trans_initiator2target_initializer(activity_sync),
+#    define TRANSACTIONS_ACTIVITY_SCHEDULE TRANSACTION_SCHEDULE(activity, SPLIT_ACTIVITY_THROTTLE_MS)
 // clang-format on
 
 #else // defined(SPLIT_ACTIVITY_ENABLE)
@@ -853,6 +1630,7 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #    define TRANSACTIONS_ACTIVITY_MASTER()
 #    define TRANSACTIONS_ACTIVITY_SLAVE()
 #    define TRANSACTIONS_ACTIVITY_REGISTRATIONS
+#    define TRANSACTIONS_ACTIVITY_SCHEDULE
 
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
@@ -875,15 +1653,123 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #    define TRANSACTIONS_DETECTED_OS_MASTER() TRANSACTION_HANDLER_MASTER(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(detected_os)
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS [PUT_DETECTED_OS] = trans_initiator2target_initializer(detected_os),
+#    define TRANSACTIONS_DETECTED_OS_SCHEDULE TRANSACTION_SCHEDULE(detected_os, SPLIT_DETECTED_OS_THROTTLE_MS)
 
 #else // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
 #    define TRANSACTIONS_DETECTED_OS_MASTER()
 #    define TRANSACTIONS_DETECTED_OS_SLAVE()
 #    define TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+#    define TRANSACTIONS_DETECTED_OS_SCHEDULE
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Serial speed negotiation
+
+#if defined(SERIAL_USART_SPEED_NEGOTIATION)
+
+#    if defined(USE_I2C) || !(defined(SERIAL_DRIVER_USART) || defined(SERIAL_DRIVER_VENDOR))
+#        error "SERIAL_USART_SPEED_NEGOTIATION requires the usart or vendor serial driver"
+#    endif
+
+#    include "serial.h"
+
+#    ifndef SERIAL_USART_SPEED_TEST_ROUNDS
+#        define SERIAL_USART_SPEED_TEST_ROUNDS 8
+#    endif // SERIAL_USART_SPEED_TEST_ROUNDS
+
+static bool serial_speed_exchange(uint8_t step, uint8_t round) {
+    split_serial_speed_t request = {.step = step};
+    uint8_t              expected[SPLIT_SERIAL_SPEED_PATTERN_SIZE];
+    uint8_t              echo[SPLIT_SERIAL_SPEED_PATTERN_SIZE];
+
+    // Alternating bits and long runs of equal bits, different every round
+    for (uint8_t i = 0; i < SPLIT_SERIAL_SPEED_PATTERN_SIZE; i++) {
+        request.pattern[i] = (i & 1 ? 0xAA : 0x55) ^ (uint8_t)(round * 0x3B) ^ (uint8_t)(i << 4);
+        expected[i]        = ~request.pattern[i];
+    }
+
+    if (!transport_execute_transaction(PUT_SERIAL_SPEED, &request, sizeof(request), echo, sizeof(echo))) {
+        return false;
+    }
+    if (memcmp(echo, expected, sizeof(echo)) != 0) {
+        SPLIT_LINK_STATS_RECORD_CHECKSUM_ERROR(PUT_SERIAL_SPEED);
+        return false;
+    }
+    return true;
+}
+
+static bool serial_speed_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t  ceiling       = SERIAL_USART_SPEED_MAX_STEP;
+    static uint8_t  negotiated    = 0;
+    static uint32_t next_exchange = 0;
+
+    uint8_t step = soft_serial_get_speed_step();
+    if (step < negotiated) {
+        // The transport fell back on an error, let the link settle before climbing again
+        negotiated    = step;
+        next_exchange = timer_read32() + 2 * SERIAL_USART_SPEED_FALLBACK_TIMEOUT;
+        return true;
+    }
+    if (!timer_expired32(timer_read32(), next_exchange)) {
+        return true;
+    }
+    next_exchange = timer_read32() + SERIAL_USART_SPEED_FALLBACK_TIMEOUT / 4;
+
+    if (step < ceiling) {
+        // Announce the next step at the current speed, the slave switches once it replied
+        if (!serial_speed_exchange(step + 1, 0)) {
+            return false;
+        }
+        soft_serial_initiator_set_speed_step(step + 1);
+
+        for (uint8_t round = 1; round <= SERIAL_USART_SPEED_TEST_ROUNDS; round++) {
+            if (!serial_speed_exchange(step + 1, round)) {
+                // Never try this step again, the slave follows back to the base speed with the next frame
+                dprintf("Serial speed step %u failed\n", step + 1);
+                ceiling = step;
+                soft_serial_initiator_set_speed_step(0);
+                negotiated    = 0;
+                next_exchange = timer_read32() + 2 * SERIAL_USART_SPEED_FALLBACK_TIMEOUT;
+                return true;
+            }
+        }
+
+        negotiated = step + 1;
+        return true;
+    }
+
+    // Keep the slave from timing out while nothing else is sent
+    return step == 0 || serial_speed_exchange(step, 0);
+}
+
+static void serial_speed_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_serial_speed_t *request = (const split_serial_speed_t *)initiator2target_buffer;
+    uint8_t                    *echo    = (uint8_t *)target2initiator_buffer;
+
+    for (uint8_t i = 0; i < SPLIT_SERIAL_SPEED_PATTERN_SIZE; i++) {
+        echo[i] = ~request->pattern[i];
+    }
+    if (request->step <= SERIAL_USART_SPEED_MAX_STEP) {
+        soft_serial_target_request_speed_step(request->step);
+    }
+}
+
+#    define TRANSACTIONS_SERIAL_SPEED_MASTER() TRANSACTION_HANDLER_MASTER(serial_speed)
+#    define TRANSACTIONS_SERIAL_SPEED_SLAVE()
+#    define TRANSACTIONS_SERIAL_SPEED_REGISTRATIONS [PUT_SERIAL_SPEED] = trans_bidirectional_initializer_cb(serial_speed, serial_speed_echo, serial_speed_slave_callback),
+#    define TRANSACTIONS_SERIAL_SPEED_SCHEDULE TRANSACTION_SCHEDULE(serial_speed, FORCED_SYNC_THROTTLE_MS)
+
+#else // defined(SERIAL_USART_SPEED_NEGOTIATION)
+
+#    define TRANSACTIONS_SERIAL_SPEED_MASTER()
+#    define TRANSACTIONS_SERIAL_SPEED_SLAVE()
+#    define TRANSACTIONS_SERIAL_SPEED_REGISTRATIONS
+#    define TRANSACTIONS_SERIAL_SPEED_SCHEDULE
+
+#endif // defined(SERIAL_USART_SPEED_NEGOTIATION)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -895,6 +1781,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BUNDLE_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -914,6 +1801,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_SERIAL_SPEED_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -924,10 +1812,146 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+////////////////////////////////////////////////////
+// Scheduler
+
+#ifdef SPLIT_TRANSACTION_SCHEDULER
+
+/*
+    The slave matrix, encoders and pointing device are latency-critical and
+    run every scan. All other members share SPLIT_TRANSACTION_BUDGET_US per
+    scan in round-robin order, continuing next scan where the budget ran out.
+    Each of them forces a sync after its own SPLIT_<MEMBER>_THROTTLE_MS
+    instead of FORCED_SYNC_THROTTLE_MS.
+*/
+
+#    ifndef SPLIT_TRANSACTION_BUDGET_US
+#        define SPLIT_TRANSACTION_BUDGET_US 1000
+#    endif // SPLIT_TRANSACTION_BUDGET_US
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        define SPLIT_SCHEDULER_NOW() ((uint32_t)chVTGetSystemTimeX())
+#        define SPLIT_SCHEDULER_ELAPSED(start) ((uint32_t)chVTTimeElapsedSinceX((systime_t)(start)))
+#        define SPLIT_SCHEDULER_BUDGET ((uint32_t)TIME_US2I(SPLIT_TRANSACTION_BUDGET_US))
+#    else
+#        define SPLIT_SCHEDULER_NOW() timer_read32()
+#        define SPLIT_SCHEDULER_ELAPSED(start) timer_elapsed32(start)
+#        define SPLIT_SCHEDULER_BUDGET ((SPLIT_TRANSACTION_BUDGET_US + 999) / 1000)
+#    endif
+
+#    ifndef SPLIT_SYNC_TIMER_THROTTLE_MS
+#        define SPLIT_SYNC_TIMER_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_LAYER_STATE_THROTTLE_MS
+#        define SPLIT_LAYER_STATE_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_LED_STATE_THROTTLE_MS
+#        define SPLIT_LED_STATE_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_MODS_THROTTLE_MS
+#        define SPLIT_MODS_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_BACKLIGHT_THROTTLE_MS
+#        define SPLIT_BACKLIGHT_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_RGBLIGHT_THROTTLE_MS
+#        define SPLIT_RGBLIGHT_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_LED_MATRIX_THROTTLE_MS
+#        define SPLIT_LED_MATRIX_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_RGB_MATRIX_THROTTLE_MS
+#        define SPLIT_RGB_MATRIX_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_WPM_THROTTLE_MS
+#        define SPLIT_WPM_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_OLED_THROTTLE_MS
+#        define SPLIT_OLED_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_ST7565_THROTTLE_MS
+#        define SPLIT_ST7565_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_HAPTIC_THROTTLE_MS
+#        define SPLIT_HAPTIC_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_ACTIVITY_THROTTLE_MS
+#        define SPLIT_ACTIVITY_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+#    ifndef SPLIT_DETECTED_OS_THROTTLE_MS
+#        define SPLIT_DETECTED_OS_THROTTLE_MS FORCED_SYNC_THROTTLE_MS
+#    endif
+
+typedef struct {
+    const char *prefix;
+    bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+    uint16_t throttle_ms;
+} split_scheduled_member_t;
+
+// Disabled members expand to nothing, so they take no turns
+#    define TRANSACTION_SCHEDULE(prefix, throttle) {#prefix, &prefix##_handlers_master, (throttle)},
+
+// clang-format off
+static const split_scheduled_member_t split_scheduled_members[] = {
+    TRANSACTIONS_SYNC_TIMER_SCHEDULE
+    TRANSACTIONS_LAYER_STATE_SCHEDULE
+    TRANSACTIONS_LED_STATE_SCHEDULE
+    TRANSACTIONS_MODS_SCHEDULE
+    TRANSACTIONS_BACKLIGHT_SCHEDULE
+    TRANSACTIONS_RGBLIGHT_SCHEDULE
+    TRANSACTIONS_LED_MATRIX_SCHEDULE
+    TRANSACTIONS_RGB_MATRIX_SCHEDULE
+    TRANSACTIONS_WPM_SCHEDULE
+    TRANSACTIONS_OLED_SCHEDULE
+    TRANSACTIONS_ST7565_SCHEDULE
+    TRANSACTIONS_WATCHDOG_SCHEDULE
+    TRANSACTIONS_HAPTIC_SCHEDULE
+    TRANSACTIONS_ACTIVITY_SCHEDULE
+    TRANSACTIONS_DETECTED_OS_SCHEDULE
+    TRANSACTIONS_SERIAL_SPEED_SCHEDULE
+};
+// clang-format on
+
+static bool transactions_master_scheduled(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t next  = 0;
+    uint32_t       start = SPLIT_SCHEDULER_NOW();
+
+    for (uint8_t ran = 0; ran < ARRAY_SIZE(split_scheduled_members); ran++) {
+        // At least one member runs every scan, so none of them can starve
+        if (ran > 0 && SPLIT_SCHEDULER_ELAPSED(start) >= SPLIT_SCHEDULER_BUDGET) {
+            break;
+        }
+
+        const split_scheduled_member_t *member = &split_scheduled_members[next];
+        split_sync_throttle_ms                 = member->throttle_ms;
+        bool okay                              = transaction_handler_master(master_matrix, slave_matrix, member->prefix, member->handler);
+        split_sync_throttle_ms                 = FORCED_SYNC_THROTTLE_MS;
+        // A failed member is tried first again next scan
+        if (!okay) {
+            return false;
+        }
+
+        if (++next >= ARRAY_SIZE(split_scheduled_members)) {
+            next = 0;
+        }
+    }
+    return true;
+}
+
+#endif // SPLIT_TRANSACTION_SCHEDULER
+
+////////////////////////////////////////////////////
+
+static bool transactions_master_scan(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BUNDLE_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+#ifdef SPLIT_TRANSACTION_SCHEDULER
+    TRANSACTIONS_POINTING_MASTER();
+    return transactions_master_scheduled(master_matrix, slave_matrix);
+#else // SPLIT_TRANSACTION_SCHEDULER
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -944,10 +1968,22 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_SERIAL_SPEED_MASTER();
     return true;
+#endif // SPLIT_TRANSACTION_SCHEDULER
+}
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    bool okay = transactions_master_scan(master_matrix, slave_matrix);
+#ifdef SPLIT_TRANSPORT_ASYNC
+    // Only now, so the synchronous transactions of the scan do not queue up behind the exchange
+    split_bundle_async_kick();
+#endif // SPLIT_TRANSPORT_ASYNC
+    return okay;
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BUNDLE_SLAVE();
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
@@ -967,6 +2003,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_SERIAL_SPEED_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -37,11 +37,47 @@ typedef struct _split_transaction_desc_t {
 // Forward declaration for the split transactions
 extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 
+// A length-prefixed transaction sends its size in the first byte, and only that many bytes follow it
+#ifdef SPLIT_TRANSACTION_BUNDLE
+#    define SPLIT_BUNDLE_IS_LENGTH_PREFIXED(id) ((id) == SPLIT_BUNDLE)
+#else // SPLIT_TRANSACTION_BUNDLE
+#    define SPLIT_BUNDLE_IS_LENGTH_PREFIXED(id) false
+#endif // SPLIT_TRANSACTION_BUNDLE
+
+#if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT) && defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
+#    define LED_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id) ((id) == PUT_LED_MATRIX_FRAMEBUFFER)
+#else // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT) && defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
+#    define LED_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id) false
+#endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT) && defined(LED_MATRIX_SPLIT_FRAMEBUFFER)
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
+#    define RGB_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id) ((id) == PUT_RGB_MATRIX_FRAMEBUFFER)
+#else // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
+#    define RGB_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id) false
+#endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT) && defined(RGB_MATRIX_SPLIT_FRAMEBUFFER)
+
+#define split_transaction_is_length_prefixed(id) (SPLIT_BUNDLE_IS_LENGTH_PREFIXED(id) || LED_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id) || RGB_MATRIX_FRAMEBUFFER_IS_LENGTH_PREFIXED(id))
+
 #define split_shmem_offset_ptr(offset) (((uint8_t *)split_shmem) + (offset))
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+#ifdef SPLIT_MATRIX_PUSH
+// Starts every frame pushed by the target, distinct from any handshake
+#    define SPLIT_PUSH_MARKER 0xA5
+// [sequence][changed row bits][changed rows][crc8]
+#    define SPLIT_PUSH_MAX_SIZE (2 + ((MATRIX_ROWS / 2) + 7) / 8 + (MATRIX_ROWS / 2) * sizeof(matrix_row_t))
+
+// Called by the transport on the initiator for every pushed frame, with a size of 0 if one was garbled
+void transaction_push_received(const uint8_t *payload, uint8_t size);
+#endif // SPLIT_MATRIX_PUSH
+
 // returns false if valid data not received from slave
+#if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE) && defined(SPLIT_POINTING_POLL_INTERVAL)
+// Reads the motion of the slave pointing device outside of the regular syncs, called by the pointing device task
+bool transaction_pointing_poll(void);
+#endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE) && defined(SPLIT_POINTING_POLL_INTERVAL)
+
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
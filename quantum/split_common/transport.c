@@ -21,6 +21,12 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "stage_probe.h"
+#include "split_link_stats.h"
+
+#if defined(SPLIT_MATRIX_PUSH) && (defined(USE_I2C) || defined(SERIAL_DRIVER_BITBANG) || !defined(SERIAL_USART_FULL_DUPLEX))
+#    error "SPLIT_MATRIX_PUSH requires the full-duplex usart or vendor SERIAL_DRIVER"
+#endif
 
 #ifdef USE_I2C
 
@@ -59,7 +65,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_writeReg(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -80,7 +86,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
         if ((status = i2c_readReg(SLAVE_I2C_ADDRESS, trans->target2initiator_offset, split_trans_target2initiator_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
-        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        // Without a destination the reply is read in place
+        if (target2initiator_buf) {
+            memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        }
     }
 
     return true;
@@ -100,7 +109,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -113,18 +122,42 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
-        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        // Without a destination the reply is read in place
+        if (target2initiator_buf) {
+            memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        }
     }
 
     return true;
 }
 
+#    ifdef SPLIT_MATRIX_PUSH
+bool transport_push(const void *payload, uint8_t size) {
+    return soft_serial_target_push(payload, size);
+}
+
+void transport_receive_pushes(void) {
+    soft_serial_initiator_receive_pushes();
+}
+#    endif // SPLIT_MATRIX_PUSH
+
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    STAGE_PROBE_BEGIN_ARG(STAGE_SPLIT_TRANSACTION, id);
+    uint32_t start = SPLIT_LINK_STATS_TIMESTAMP();
+    bool     okay  = transport_execute_transaction_impl(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    SPLIT_LINK_STATS_RECORD(id, okay, start);
+    STAGE_PROBE_END_ARG(STAGE_SPLIT_TRANSACTION, okay);
+    return okay;
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    STAGE_PROBE_BEGIN(STAGE_SPLIT_SLAVE);
     transactions_slave(master_matrix, slave_matrix);
+    STAGE_PROBE_END(STAGE_SPLIT_SLAVE);
 }
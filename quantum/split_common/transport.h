@@ -31,6 +31,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_BUNDLE_BUFFER_SIZE
+#    define SPLIT_BUNDLE_BUFFER_SIZE 64
+#endif // SPLIT_BUNDLE_BUFFER_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -40,6 +44,13 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_MATRIX_PUSH
+// target sends a frame without waiting for the initiator
+bool transport_push(const void *payload, uint8_t size);
+// initiator collects the frames pushed since the last call
+void transport_receive_pushes(void);
+#endif // SPLIT_MATRIX_PUSH
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -79,6 +90,9 @@ typedef struct _split_layers_sync_t {
 
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 #    include "led_matrix.h"
+#    ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+#        include "split_framebuffer.h"
+#    endif // LED_MATRIX_SPLIT_FRAMEBUFFER
 
 typedef struct _led_matrix_sync_t {
     led_eeconfig_t led_matrix;
@@ -88,6 +102,9 @@ typedef struct _led_matrix_sync_t {
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 #    include "rgb_matrix.h"
+#    ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+#        include "split_framebuffer.h"
+#    endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
 
 typedef struct _rgb_matrix_sync_t {
     rgb_config_t rgb_matrix;
@@ -107,10 +124,24 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+// Running totals of the motion on the slave, wrapping. The initiator applies the difference to the last totals it saw,
+// so motion is neither clamped to a single report nor lost with a failed read.
+typedef struct _split_pointing_motion_t {
+    int16_t x;
+    int16_t y;
+    int16_t h;
+    int16_t v;
+    uint8_t buttons;
+} split_pointing_motion_t;
+
+typedef struct _split_pointing_sample_t {
+    uint8_t                 checksum;
+    split_pointing_motion_t motion;
+} split_pointing_sample_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    split_pointing_sample_t sample;
+    uint16_t                cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -146,13 +177,44 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SERIAL_USART_SPEED_NEGOTIATION
+#    define SPLIT_SERIAL_SPEED_PATTERN_SIZE 8
+// Requests a speed step, the target echoes the complemented test pattern
+typedef struct _split_serial_speed_t {
+    uint8_t step;
+    uint8_t pattern[SPLIT_SERIAL_SPEED_PATTERN_SIZE];
+} split_serial_speed_t;
+#endif // SERIAL_USART_SPEED_NEGOTIATION
+
+#ifdef SPLIT_TRANSACTION_BUNDLE
+// Everything the initiator reads from the target every scan, returned in a single reply
+typedef struct _split_bundle_s2m_t {
+    split_slave_matrix_sync_t smatrix;
+#    ifdef ENCODER_ENABLE
+    split_slave_encoder_sync_t encoders;
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    split_slave_pointing_sync_t pointing;
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+} split_bundle_s2m_t;
+#endif // SPLIT_TRANSACTION_BUNDLE
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTION_BUNDLE
+    uint8_t            bundle_m2s[SPLIT_BUNDLE_BUFFER_SIZE];
+    split_bundle_s2m_t bundle_s2m;
+#endif // SPLIT_TRANSACTION_BUNDLE
+
     split_slave_matrix_sync_t smatrix;
 
+#ifdef MATRIX_SCAN_TIMESTAMPS
+    uint16_t smatrix_time[(MATRIX_ROWS) / 2][MATRIX_COLS];
+#endif // MATRIX_SCAN_TIMESTAMPS
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -187,10 +249,16 @@ typedef struct _split_shared_memory_t {
 
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
     led_matrix_sync_t led_matrix_sync;
+#    ifdef LED_MATRIX_SPLIT_FRAMEBUFFER
+    uint8_t led_matrix_framebuffer[1 + SPLIT_FRAMEBUFFER_BUDGET];
+#    endif // LED_MATRIX_SPLIT_FRAMEBUFFER
 #endif // defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     rgb_matrix_sync_t rgb_matrix_sync;
+#    ifdef RGB_MATRIX_SPLIT_FRAMEBUFFER
+    uint8_t rgb_matrix_framebuffer[1 + SPLIT_FRAMEBUFFER_BUDGET];
+#    endif // RGB_MATRIX_SPLIT_FRAMEBUFFER
 #endif // defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
@@ -230,6 +298,11 @@ typedef struct _split_shared_memory_t {
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
     os_variant_t detected_os;
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
+
+#ifdef SERIAL_USART_SPEED_NEGOTIATION
+    split_serial_speed_t serial_speed;
+    uint8_t              serial_speed_echo[SPLIT_SERIAL_SPEED_PATTERN_SIZE];
+#endif // SERIAL_USART_SPEED_NEGOTIATION
 } split_shared_memory_t;
 
 extern split_shared_memory_t *const split_shmem;
@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Stage probes mark the entry and exit of the stages on the hot path between
+    a matrix change and a report being handed to the host driver, so that the
+    time spent in each can be attributed.
+
+    They compile to nothing unless STAGE_PROBE_ENABLE is defined, in which case
+    the build must provide stage_probe_begin() and stage_probe_end(). The host
+    side latency benchmark in tests/benchmark and the on-device trace buffer in
+    perf_trace.c are the two consumers. The optional argument is stage specific.
+    On entry it is the key position (row << 8 | col) for STAGE_ACTION_EXEC and
+    STAGE_PROCESS_RECORD, the endpoint for STAGE_USB_SEND_REPORT and the
+    transaction id for STAGE_SPLIT_TRANSACTION. On exit it carries the result
+    of STAGE_PROCESS_RECORD and STAGE_SPLIT_TRANSACTION.
+
+    Stages may nest (e.g. STAGE_HOST_SEND inside STAGE_PROCESS_RECORD inside
+    STAGE_ACTION_EXEC), and STAGE_PROCESS_RECORD may be re-entered while
+    tapping replays buffered records.
+*/
+
+#include <stdint.h>
+
+typedef enum {
+    STAGE_MATRIX_SCAN,
+    STAGE_ACTION_EXEC,
+    STAGE_PROCESS_RECORD,
+    STAGE_HOST_SEND,
+    STAGE_USB_SEND_REPORT,
+    STAGE_SPLIT_TRANSACTION,
+    STAGE_SPLIT_SLAVE,
+    STAGE_COUNT,
+} stage_probe_t;
+
+#ifdef STAGE_PROBE_ENABLE
+
+#    ifdef __cplusplus
+extern "C" {
+#    endif
+
+void stage_probe_begin(stage_probe_t stage, uint16_t arg);
+void stage_probe_end(stage_probe_t stage, uint16_t arg);
+
+#    ifdef __cplusplus
+}
+#    endif
+
+#    define STAGE_PROBE_BEGIN_ARG(stage, arg) stage_probe_begin(stage, arg)
+#    define STAGE_PROBE_END_ARG(stage, arg) stage_probe_end(stage, arg)
+
+#else
+
+#    define STAGE_PROBE_BEGIN_ARG(stage, arg) \
+        do {                                 \
+        } while (0)
+#    define STAGE_PROBE_END_ARG(stage, arg) \
+        do {                               \
+        } while (0)
+
+#endif // STAGE_PROBE_ENABLE
+
+#define STAGE_PROBE_BEGIN(stage) STAGE_PROBE_BEGIN_ARG(stage, 0)
+#define STAGE_PROBE_END(stage) STAGE_PROBE_END_ARG(stage, 0)
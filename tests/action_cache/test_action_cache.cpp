@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "action_cache.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class ActionCache : public TestFixture {};
+
+TEST_F(ActionCache, cached_action_is_returned) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    action_t action;
+    EXPECT_TRUE(action_cache_get(0, key.position, &action));
+    EXPECT_EQ(action.code, ACTION_KEY(KC_A));
+}
+
+TEST_F(ActionCache, keymap_change_invalidates_cache) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    set_keymap({key_b});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ActionCache, explicit_invalidation) {
+    const keypos_t position = {.col = 3, .row = 2};
+    action_cache_set(1, position, (action_t){.code = ACTION_KEY(KC_C)});
+
+    action_t action;
+    EXPECT_TRUE(action_cache_get(1, position, &action));
+    EXPECT_EQ(action.code, ACTION_KEY(KC_C));
+
+    action_cache_invalidate();
+    EXPECT_FALSE(action_cache_get(1, position, &action));
+}
+
+TEST_F(ActionCache, out_of_range_positions_are_not_cached) {
+    const keypos_t position = {.col = 0, .row = MATRIX_ROWS};
+    action_cache_set(0, position, (action_t){.code = ACTION_KEY(KC_C)});
+
+    action_t action;
+    EXPECT_FALSE(action_cache_get(0, position, &action));
+}
+
+TEST_F(ActionCache, magic_swap_invalidates_cache) {
+    TestDriver driver;
+    InSequence s;
+    auto       ctrl_key = KeymapKey(0, 0, 0, KC_LEFT_CTRL);
+    auto       swap_key = KeymapKey(0, 1, 0, CG_SWAP);
+    auto       norm_key = KeymapKey(0, 2, 0, CG_NORM);
+
+    set_keymap({ctrl_key, swap_key, norm_key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(ctrl_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(swap_key);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The cached action for ctrl_key must not survive the swap */
+    EXPECT_REPORT(driver, (KC_LEFT_GUI));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(ctrl_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(norm_key);
+    VERIFY_AND_CLEAR(driver);
+}
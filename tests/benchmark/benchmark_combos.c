@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { escape };
+
+uint16_t const escape_combo[] = {KC_Y, KC_U, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [escape] = COMBO(escape_combo, KC_ESCAPE),
+};
+// clang-format on
@@ -0,0 +1,87 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "latency_histogram.hpp"
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <numeric>
+
+namespace {
+
+constexpr size_t bucket_count = 40;
+
+size_t bucket_for(uint64_t ns) {
+    size_t bucket = 0;
+    while (ns > 1 && bucket < bucket_count - 1) {
+        ns >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+} // namespace
+
+void LatencyHistogram::add(uint64_t ns) {
+    if (!m_samples.empty() && ns < m_samples.back()) {
+        m_sorted = false;
+    }
+    m_samples.push_back(ns);
+}
+
+void LatencyHistogram::clear() {
+    m_samples.clear();
+    m_sorted = true;
+}
+
+uint64_t LatencyHistogram::min() const {
+    return percentile(0);
+}
+
+uint64_t LatencyHistogram::max() const {
+    return percentile(100);
+}
+
+uint64_t LatencyHistogram::mean() const {
+    if (m_samples.empty()) {
+        return 0;
+    }
+    return std::accumulate(m_samples.begin(), m_samples.end(), uint64_t{0}) / m_samples.size();
+}
+
+uint64_t LatencyHistogram::percentile(unsigned p) const {
+    if (m_samples.empty()) {
+        return 0;
+    }
+    if (!m_sorted) {
+        auto& samples = const_cast<std::vector<uint64_t>&>(m_samples);
+        std::sort(samples.begin(), samples.end());
+        m_sorted = true;
+    }
+    size_t rank = (m_samples.size() * std::min(p, 100u) + 99) / 100;
+    return m_samples[rank == 0 ? 0 : rank - 1];
+}
+
+void LatencyHistogram::print_header(std::ostream& out) {
+    out << std::left << std::setw(22) << "stage" << std::right << std::setw(9) << "samples" << std::setw(10) << "min" << std::setw(10) << "mean" << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "max"
+        << "  (ns)" << std::endl;
+}
+
+void LatencyHistogram::print_summary(std::ostream& out) const {
+    out << std::left << std::setw(22) << m_name << std::right << std::setw(9) << count() << std::setw(10) << min() << std::setw(10) << mean() << std::setw(10) << percentile(50) << std::setw(10) << percentile(90) << std::setw(10) << percentile(99) << std::setw(10) << max() << std::endl;
+}
+
+void LatencyHistogram::print_buckets(std::ostream& out) const {
+    std::array<size_t, bucket_count> buckets{};
+    for (uint64_t sample : m_samples) {
+        buckets[bucket_for(sample)]++;
+    }
+
+    out << "  " << m_name << ":";
+    for (size_t i = 0; i < bucket_count; i++) {
+        if (buckets[i]) {
+            out << " <" << (uint64_t{2} << i) << "ns:" << buckets[i];
+        }
+    }
+    out << std::endl;
+}
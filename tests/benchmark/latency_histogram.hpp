@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Collects nanosecond samples for one stage and summarises them as
+ * percentiles plus a power-of-two bucketed histogram.
+ */
+class LatencyHistogram {
+   public:
+    explicit LatencyHistogram(std::string name) : m_name(std::move(name)) {}
+
+    void add(uint64_t ns);
+    void clear();
+
+    const std::string& name() const {
+        return m_name;
+    }
+    size_t count() const {
+        return m_samples.size();
+    }
+
+    uint64_t min() const;
+    uint64_t max() const;
+    uint64_t mean() const;
+    /** @brief Nearest-rank percentile, `p` in the range 0..100. */
+    uint64_t percentile(unsigned p) const;
+
+    /** @brief Prints one summary row, matching `print_header`. */
+    void print_summary(std::ostream& out) const;
+    /** @brief Prints the non-empty power-of-two buckets. */
+    void print_buckets(std::ostream& out) const;
+
+    static void print_header(std::ostream& out);
+
+   private:
+    std::string           m_name;
+    std::vector<uint64_t> m_samples;
+    mutable bool          m_sorted = true;
+};
@@ -0,0 +1,221 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "latency_histogram.hpp"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "stage_probe.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::AnyNumber;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+uint64_t elapsed_ns(clock_type::time_point since) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - since).count();
+}
+
+struct StageTimer {
+    clock_type::time_point start;
+    unsigned               depth = 0;
+};
+
+std::array<StageTimer, STAGE_COUNT> stage_timers;
+
+std::array<LatencyHistogram, STAGE_COUNT> stage_histograms = {
+    LatencyHistogram("matrix_scan"),
+    LatencyHistogram("action_exec"),
+    LatencyHistogram("process_record_quantum"),
+    LatencyHistogram("host_keyboard_send"),
+    LatencyHistogram("usb_send_report"),
+    LatencyHistogram("split_transaction"),
+    LatencyHistogram("split_slave"),
+};
+
+LatencyHistogram keyboard_task_histogram("keyboard_task");
+LatencyHistogram scan_to_report_histogram("scan_to_report");
+
+} // namespace
+
+/* Probes are re-entrant for the nested process_record calls made while the
+ * tapping state machine replays its buffer, only the outermost pair is timed. */
+extern "C" void stage_probe_begin(stage_probe_t stage, uint16_t arg) {
+    StageTimer& timer = stage_timers[stage];
+    if (timer.depth++ == 0) {
+        timer.start = clock_type::now();
+    }
+
+    if (stage == STAGE_HOST_SEND) {
+        scan_to_report_histogram.add(elapsed_ns(stage_timers[STAGE_MATRIX_SCAN].start));
+    }
+}
+
+extern "C" void stage_probe_end(stage_probe_t stage, uint16_t arg) {
+    StageTimer& timer = stage_timers[stage];
+    if (timer.depth > 0 && --timer.depth == 0) {
+        stage_histograms[stage].add(elapsed_ns(timer.start));
+    }
+}
+
+class LatencyBenchmark : public TestFixture {
+   protected:
+    void SetUp() override {
+        reset_histograms();
+    }
+
+    static void reset_histograms() {
+        for (auto& histogram : stage_histograms) {
+            histogram.clear();
+        }
+        keyboard_task_histogram.clear();
+        scan_to_report_histogram.clear();
+    }
+
+    /** @brief Runs `loops` keyboard task iterations, timing each one. */
+    void scan(unsigned loops = 1) {
+        for (unsigned i = 0; i < loops; i++) {
+            auto start = clock_type::now();
+            keyboard_task();
+            keyboard_task_histogram.add(elapsed_ns(start));
+            advance_time(1);
+        }
+    }
+
+    /** @brief Prints the collected numbers and records them as test properties,
+     * so that `--gtest_output=json` captures them for comparison across runs. */
+    void report() {
+        const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+
+        std::cout << "[ BENCH    ] " << test_info->name() << std::endl;
+        LatencyHistogram::print_header(std::cout);
+        for (const auto* histogram : all_histograms()) {
+            histogram->print_summary(std::cout);
+        }
+        for (const auto* histogram : all_histograms()) {
+            histogram->print_buckets(std::cout);
+        }
+
+        for (const auto* histogram : all_histograms()) {
+            RecordProperty(histogram->name() + "_p50_ns", std::to_string(histogram->percentile(50)));
+            RecordProperty(histogram->name() + "_p99_ns", std::to_string(histogram->percentile(99)));
+        }
+
+        EXPECT_GT(stage_histograms[STAGE_MATRIX_SCAN].count(), 0u);
+        EXPECT_GT(stage_histograms[STAGE_ACTION_EXEC].count(), 0u);
+        EXPECT_GT(stage_histograms[STAGE_PROCESS_RECORD].count(), 0u);
+        EXPECT_GT(stage_histograms[STAGE_HOST_SEND].count(), 0u);
+    }
+
+    static std::array<const LatencyHistogram*, 6> all_histograms() {
+        return {&keyboard_task_histogram, &stage_histograms[STAGE_MATRIX_SCAN], &stage_histograms[STAGE_ACTION_EXEC], &stage_histograms[STAGE_PROCESS_RECORD], &stage_histograms[STAGE_HOST_SEND], &scan_to_report_histogram};
+    }
+
+    static constexpr unsigned iterations = 200;
+};
+
+TEST_F(LatencyBenchmark, Burst) {
+    TestDriver driver;
+    KeymapKey  keys[] = {
+        KeymapKey(0, 0, 0, KC_A), KeymapKey(0, 1, 0, KC_S), KeymapKey(0, 2, 0, KC_D), KeymapKey(0, 3, 1, KC_F), KeymapKey(0, 4, 1, KC_G), KeymapKey(0, 5, 2, KC_H),
+    };
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5]});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (unsigned i = 0; i < iterations; i++) {
+        for (auto& key : keys) {
+            key.press();
+        }
+        scan();
+        for (auto& key : keys) {
+            key.release();
+        }
+        scan(2);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    report();
+}
+
+TEST_F(LatencyBenchmark, Rollover) {
+    TestDriver driver;
+    KeymapKey  keys[] = {
+        KeymapKey(0, 0, 0, KC_Q), KeymapKey(0, 1, 0, KC_W), KeymapKey(0, 2, 0, KC_E), KeymapKey(0, 3, 0, KC_R), KeymapKey(0, 4, 0, KC_T),
+    };
+    const size_t key_count = sizeof(keys) / sizeof(keys[0]);
+    set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4]});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (unsigned i = 0; i < iterations; i++) {
+        /* Each key goes down before the previous one comes up. */
+        keys[0].press();
+        scan(5);
+        for (size_t k = 1; k < key_count; k++) {
+            keys[k].press();
+            scan(5);
+            keys[k - 1].release();
+            scan(5);
+        }
+        keys[key_count - 1].release();
+        scan(5);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    report();
+}
+
+TEST_F(LatencyBenchmark, ModTapRoll) {
+    TestDriver driver;
+    KeymapKey  mod_tap_key(0, 0, 0, SFT_T(KC_F));
+    KeymapKey  regular_key(0, 1, 0, KC_J);
+    set_keymap({mod_tap_key, regular_key});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (unsigned i = 0; i < iterations; i++) {
+        mod_tap_key.press();
+        scan(20);
+        regular_key.press();
+        scan(20);
+        mod_tap_key.release();
+        scan(20);
+        regular_key.release();
+        scan(TAPPING_TERM);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    report();
+}
+
+TEST_F(LatencyBenchmark, Combo) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 0, KC_Y);
+    KeymapKey  key_u(0, 1, 0, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    for (unsigned i = 0; i < iterations; i++) {
+        key_y.press();
+        scan();
+        key_u.press();
+        scan(5);
+        key_y.release();
+        scan();
+        key_u.release();
+        scan(COMBO_TERM);
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    report();
+}
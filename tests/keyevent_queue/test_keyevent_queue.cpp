@@ -0,0 +1,190 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "keyevent_queue.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class KeyeventQueue : public TestFixture {};
+
+static keyevent_t press_event(uint8_t row) {
+    keyevent_t event = {};
+    event.key.row    = row;
+    event.pressed    = true;
+    event.type       = KEY_EVENT;
+    return event;
+}
+
+TEST_F(KeyeventQueue, events_are_processed_in_order) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    // Both changes are queued by one scan, and dispatched in column order
+    key_a.release();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(keyevent_queue_depth(), 0);
+}
+
+TEST_F(KeyeventQueue, overflowing_changes_are_retried) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+    auto       key_f = KeymapKey(0, 5, 0, KC_F);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e, key_f});
+    keyevent_queue_clear_stats();
+
+    // Six changes in one scan, only four fit
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    EXPECT_REPORT(driver, (KC_A, KC_B)).Times(1);
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C)).Times(1);
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D)).Times(1);
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    key_f.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    keyevent_queue_stats_t stats;
+    keyevent_queue_get_stats(&stats);
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.max_depth, 4);
+    // The scan stops at the first refused change
+    EXPECT_EQ(stats.overflows, 1);
+
+    // The refused presses are picked up by the next scan
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E)).Times(1);
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F)).Times(1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D, KC_E, KC_F)).Times(1);
+    EXPECT_REPORT(driver, (KC_C, KC_D, KC_E, KC_F)).Times(1);
+    EXPECT_REPORT(driver, (KC_D, KC_E, KC_F)).Times(1);
+    EXPECT_REPORT(driver, (KC_E, KC_F)).Times(1);
+    EXPECT_REPORT(driver, (KC_F)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    key_e.release();
+    key_f.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyeventQueue, refused_changes_are_delivered_before_the_next_scan) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Released before its press was queued, the press still comes first
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    key_e.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyeventQueue, push_and_pop) {
+    keyevent_t event;
+
+    keyevent_queue_clear_stats();
+    EXPECT_FALSE(keyevent_queue_pop(&event));
+
+    for (uint8_t i = 0; i < KEYEVENT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(keyevent_queue_push(press_event(i)));
+    }
+    EXPECT_FALSE(keyevent_queue_push(press_event(KEYEVENT_QUEUE_SIZE)));
+    EXPECT_EQ(keyevent_queue_depth(), KEYEVENT_QUEUE_SIZE);
+
+    for (uint8_t i = 0; i < KEYEVENT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(keyevent_queue_pop(&event));
+        EXPECT_EQ(event.key.row, i);
+        EXPECT_TRUE(event.pressed);
+    }
+    EXPECT_FALSE(keyevent_queue_pop(&event));
+
+    keyevent_queue_stats_t stats;
+    keyevent_queue_get_stats(&stats);
+    EXPECT_EQ(stats.depth, 0);
+    EXPECT_EQ(stats.max_depth, KEYEVENT_QUEUE_SIZE);
+    EXPECT_EQ(stats.overflows, 1);
+}
+
+TEST_F(KeyeventQueue, flush_drops_queued_events) {
+    keyevent_t event;
+
+    for (uint8_t i = 0; i < 3; i++) {
+        EXPECT_TRUE(keyevent_queue_push(press_event(i)));
+    }
+    keyevent_queue_flush();
+    EXPECT_EQ(keyevent_queue_depth(), 0);
+    EXPECT_FALSE(keyevent_queue_pop(&event));
+
+    EXPECT_TRUE(keyevent_queue_push(press_event(7)));
+    EXPECT_TRUE(keyevent_queue_pop(&event));
+    EXPECT_EQ(event.key.row, 7);
+}
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Scan through matrix_common.c, which stamps the key edges
+CUSTOM_MATRIX = lite
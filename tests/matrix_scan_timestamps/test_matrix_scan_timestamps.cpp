@@ -0,0 +1,132 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InSequence;
+
+class MatrixScanTimestamps : public TestFixture {
+   protected:
+    // A scan that runs ahead of processing, as one on its own thread or timer would
+    void scan_only(void) {
+        matrix_scan();
+    }
+};
+
+TEST_F(MatrixScanTimestamps, key_time_is_the_raw_edge_not_the_debounced_change) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key});
+
+    key.press();
+    uint16_t pressed = timer_read();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    idle_for(DEBOUNCE);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(matrix_get_key_time(0, 1), pressed);
+
+    key.release();
+    uint16_t released = timer_read();
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(DEBOUNCE + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(matrix_get_key_time(0, 1), released);
+}
+
+TEST_F(MatrixScanTimestamps, tap_released_within_tapping_term_is_a_tap_after_a_stalled_loop) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* Press mod-tap key */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(DEBOUNCE + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release it within the tapping term, the scan sees it but processing stalls */
+    advance_time(TAPPING_TERM / 2);
+    mod_tap_key.release();
+    scan_only();
+    advance_time(TAPPING_TERM);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScanTimestamps, tap_released_after_tapping_term_is_a_hold_after_a_stalled_loop) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    /* Press mod-tap key */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(DEBOUNCE + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release it after the tapping term, the stalled loop doesn't get to see the hold first */
+    advance_time(TAPPING_TERM);
+    mod_tap_key.release();
+    scan_only();
+    advance_time(TAPPING_TERM);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScanTimestamps, event_times_do_not_go_backwards) {
+    TestDriver driver;
+    InSequence s;
+    auto       first_key  = KeymapKey(0, 1, 0, KC_A);
+    auto       second_key = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({first_key, second_key});
+
+    /* Second key changes first, both are debounced together and the first key is dispatched first */
+    second_key.press();
+    run_one_scan_loop();
+    advance_time(2);
+    first_key.press();
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    idle_for(DEBOUNCE + 1);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_NE(matrix_get_key_time(0, 1), matrix_get_key_time(0, 2));
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    first_key.release();
+    idle_for(DEBOUNCE + 1);
+    second_key.release();
+    idle_for(DEBOUNCE + 1);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Stands in for the pins of a CUSTOM_MATRIX = lite test, matrix_common.c does
+// the scanning, debouncing and anything else a real keyboard's matrix does
+
+#include "matrix.h"
+#include "test_matrix.h"
+#include <string.h>
+
+static matrix_row_t pins[MATRIX_ROWS] = {};
+
+void matrix_init_custom(void) {
+    clear_all_keys();
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    bool changed = memcmp(current_matrix, pins, sizeof(pins)) != 0;
+    memcpy(current_matrix, pins, sizeof(pins));
+    return changed;
+}
+
+void press_key(uint8_t col, uint8_t row) {
+    pins[row] |= (matrix_row_t)1 << col;
+}
+
+void release_key(uint8_t col, uint8_t row) {
+    pins[row] &= ~((matrix_row_t)1 << col);
+}
+
+void clear_all_keys(void) {
+    memset(pins, 0, sizeof(pins));
+}
+
+void led_set(uint8_t usb_led) {}
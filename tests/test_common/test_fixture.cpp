@@ -22,6 +22,9 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef ACTION_CACHE_ENABLE
+#    include "action_cache.h"
+#endif
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -99,6 +102,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#ifdef ACTION_CACHE_ENABLE
+    action_cache_invalidate();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -126,6 +132,9 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+#ifdef ACTION_CACHE_ENABLE
+    action_cache_invalidate();
+#endif
     for (auto& key : keys) {
         add_key(key);
     }
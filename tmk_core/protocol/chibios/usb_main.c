@@ -43,6 +43,7 @@
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
 #include "usb_driver.h"
+#include "stage_probe.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -860,9 +861,11 @@ uint8_t keyboard_leds(void) {
 }
 
 void send_report(uint8_t endpoint, void *report, size_t size) {
+    STAGE_PROBE_BEGIN_ARG(STAGE_USB_SEND_REPORT, endpoint);
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
         osalSysUnlock();
+        STAGE_PROBE_END_ARG(STAGE_USB_SEND_REPORT, endpoint);
         return;
     }
 
@@ -873,11 +876,13 @@ void send_report(uint8_t endpoint, void *report, size_t size) {
          * Note: for suspend, need USB_USE_WAIT == TRUE in halconf.h */
         if (osalThreadSuspendTimeoutS(&(&USB_DRIVER)->epc[endpoint]->in_state->thread, TIME_MS2I(10)) == MSG_TIMEOUT) {
             osalSysUnlock();
+            STAGE_PROBE_END_ARG(STAGE_USB_SEND_REPORT, endpoint);
             return;
         }
     }
     usbStartTransmitI(&USB_DRIVER, endpoint, report, size);
     osalSysUnlock();
+    STAGE_PROBE_END_ARG(STAGE_USB_SEND_REPORT, endpoint);
 }
 
 /* prepare and start sending a report IN
@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "stage_probe.h"
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -95,7 +96,9 @@ void host_keyboard_send(report_keyboard_t *report) {
         report->report_id = REPORT_ID_KEYBOARD;
 #endif
     }
+    STAGE_PROBE_BEGIN(STAGE_HOST_SEND);
     (*driver->send_keyboard)(report);
+    STAGE_PROBE_END(STAGE_HOST_SEND);
 
     if (debug_keyboard) {
         dprint("keyboard_report: ");